@@ -0,0 +1,39 @@
+#!/bin/bash
+
+set -euo pipefail
+
+# ===== User Config =====
+# StackFS mounted on MOUNT_POINT from ROOT_DIR with --fsync_mode=group
+# --statsdir=STATS_DIR, a second lower F/S on ROOT_DIR/other
+# (see fio/fsync_devs.fio)
+FIO_JOB="../../fio/fsync_devs.fio"
+ROOT_DIR="/mnt/RFUSE_EXT4"
+MOUNT_POINT="/mnt/test"
+STATS_DIR="/tmp"
+
+# ===== Helpers =====
+function stat_value() {
+  awk -F ',' -v k="$1" '$1 == k { print $2 }' "${STATS_DIR}/stackfs_stats.csv"
+}
+
+# ===== Main =====
+if [ "$(stat -c %d "${ROOT_DIR}")" == "$(stat -c %d "${ROOT_DIR}/other")" ]; then
+  echo "${ROOT_DIR}/other is not a separate file system"
+  exit 1
+fi
+
+fio "${FIO_JOB}" >/dev/null
+
+# the stats are final once the daemon is gone
+sudo umount "${MOUNT_POINT}"
+while pgrep -f "StackFS_ll" >/dev/null; do
+  sleep 1
+done
+
+single=$(stat_value fsync_single)
+grouped=$(stat_value fsync_grouped)
+echo "fsync_single=${single} fsync_grouped=${grouped}"
+if [ "${grouped}" != "0" ]; then
+  echo "FSYNCs on different file systems were answered by one syncfs"
+  exit 1
+fi
@@ -10,6 +10,8 @@ DEVICE_NAME=("/dev/nvme1n1")
 
 MOUNT_BASE="/mnt/RFUSE_EXT4"
 MOUNT_POINT="/mnt/test"
+# extra StackFS options, e.g. ("--passthrough" "--passthrough_exclude=*.1.0")
+STACKFS_OPTS=()
 
 SECTIONS=("read" "write" "randread" "randwrite") # 1.1
 BS_LIST=("4k" "128k")                            # 1.2
@@ -66,7 +68,7 @@ function init_mount_point() {
     cp /home/ldy/src/rfuse/filesystems/stackfs/StackFS_LowLevel.c.fuse /home/ldy/src/rfuse/filesystems/stackfs/StackFS_LowLevel.c
     make clean
     make
-    ./StackFS_ll -r "${MOUNT_BASE}" "${MOUNT_POINT}" &
+    ./StackFS_ll -r "${MOUNT_BASE}" ${STACKFS_OPTS[@]+"${STACKFS_OPTS[@]}"} "${MOUNT_POINT}" &
     popd >/dev/null
     sudo sync
 
@@ -88,7 +90,7 @@ function init_mount_point() {
     cp /home/ldy/src/rfuse/filesystems/stackfs/StackFS_LowLevel.c.rfuse /home/ldy/src/rfuse/filesystems/stackfs/StackFS_LowLevel.c
     make clean
     make
-    ./StackFS_ll -r "${MOUNT_BASE}" "${MOUNT_POINT}" &
+    ./StackFS_ll -r "${MOUNT_BASE}" ${STACKFS_OPTS[@]+"${STACKFS_OPTS[@]}"} "${MOUNT_POINT}" &
     popd >/dev/null
     sudo sync
 
@@ -134,7 +136,7 @@ function remount_point() {
     cp /home/ldy/src/rfuse/filesystems/stackfs/StackFS_LowLevel.c.fuse /home/ldy/src/rfuse/filesystems/stackfs/StackFS_LowLevel.c
     make clean
     make
-    ./StackFS_ll -r "${MOUNT_BASE}" "${MOUNT_POINT}" &
+    ./StackFS_ll -r "${MOUNT_BASE}" ${STACKFS_OPTS[@]+"${STACKFS_OPTS[@]}"} "${MOUNT_POINT}" &
     popd >/dev/null
     sudo sync
 
@@ -155,7 +157,7 @@ function remount_point() {
     cp /home/ldy/src/rfuse/filesystems/stackfs/StackFS_LowLevel.c.rfuse /home/ldy/src/rfuse/filesystems/stackfs/StackFS_LowLevel.c
     make clean
     make
-    ./StackFS_ll -r "${MOUNT_BASE}" "${MOUNT_POINT}" &
+    ./StackFS_ll -r "${MOUNT_BASE}" ${STACKFS_OPTS[@]+"${STACKFS_OPTS[@]}"} "${MOUNT_POINT}" &
     popd >/dev/null
     sudo sync
 
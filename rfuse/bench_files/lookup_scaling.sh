@@ -0,0 +1,28 @@
+#!/bin/bash
+
+set -euo pipefail
+
+# ===== User Config =====
+# StackFS already mounted on MOUNT_POINT with --attrval=0 (see fio/lookup.fio)
+FIO_JOB="../../fio/lookup.fio"
+THREADS=("1" "2" "4" "8" "16" "32" "64")
+RUNTIME="30"
+
+# ===== Helpers =====
+# read IOPS of the last group in fio's terse output (field 8)
+function fio_iops() {
+  tail -n 1 | cut -d ';' -f 8
+}
+
+# ===== Main =====
+NUMJOBS=1 RUNTIME="${RUNTIME}" fio --section=prepare "${FIO_JOB}" >/dev/null
+
+echo "threads,lookups_per_sec,per_thread,speedup"
+base=""
+for n in "${THREADS[@]}"; do
+  iops=$(NUMJOBS="${n}" RUNTIME="${RUNTIME}" \
+    fio --section=lookup --minimal "${FIO_JOB}" | fio_iops)
+  base=${base:-${iops}}
+  awk -v n="${n}" -v i="${iops}" -v b="${base}" \
+    'BEGIN { printf "%d,%d,%d,%.2f\n", n, i, i / n, b ? i / b : 0 }'
+done
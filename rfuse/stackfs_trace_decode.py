@@ -0,0 +1,65 @@
+import argparse
+import csv
+import struct
+import sys
+
+# Must match struct trace_file_hdr / struct trace_rec in
+# StackFS_files/StackFS_LowLevel.c.*
+TRACE_MAGIC = b"STKTRC01"
+HDR = struct.Struct("<8sII")
+REC = struct.Struct("<QIHHQQIi")
+
+OPS = {
+    1: "lookup",
+    2: "getattr",
+    3: "read",
+    4: "write",
+    5: "fsync",
+    6: "fallocate",
+    7: "readdir",
+    8: "readdirplus",
+}
+PHASES = {0: "start", 1: "end"}
+
+
+def decode(path, out):
+    with open(path, "rb") as f:
+        hdr = f.read(HDR.size)
+        if len(hdr) != HDR.size:
+            sys.exit(f"{path}: short header")
+        magic, rec_size, _ = HDR.unpack(hdr)
+        if magic != TRACE_MAGIC:
+            sys.exit(f"{path}: bad magic {magic!r}")
+        if rec_size != REC.size:
+            sys.exit(f"{path}: record size {rec_size}, expected {REC.size}")
+
+        w = csv.writer(out)
+        w.writerow(["ts_ns", "tid", "op", "phase", "ino", "offset", "size", "res"])
+        count = 0
+        while True:
+            rec = f.read(REC.size)
+            if len(rec) < REC.size:
+                break
+            ts, tid, op, phase, ino, off, size, res = REC.unpack(rec)
+            w.writerow([ts, tid, OPS.get(op, op), PHASES.get(phase, phase),
+                        ino, off, size, res])
+            count += 1
+    return count
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode a StackFS binary trace (stackfs_trace.bin) to CSV")
+    parser.add_argument("trace", help="path to stackfs_trace.bin")
+    parser.add_argument("--out", help="CSV output file (default: stdout)")
+    args = parser.parse_args()
+
+    if args.out:
+        with open(args.out, "w", newline="") as out:
+            count = decode(args.trace, out)
+        print(f"{count} records written to {args.out}")
+    else:
+        decode(args.trace, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
@@ -40,3 +40,53 @@ int up_rfuse_latency_probe(struct pt_regs *ctx)
     return 0;
 }
 
+struct {
+    __uint(type, BPF_MAP_TYPE_RINGBUF);
+    __uint(max_entries, 1 << 24);
+} stackfs_poll_events SEC(".maps");
+
+SEC("uprobe/stackfs_poll_probe")
+int up_stackfs_poll_probe(struct pt_regs *ctx)
+{
+    struct stackfs_poll_event *e;
+
+    e = bpf_ringbuf_reserve(&stackfs_poll_events, sizeof(*e), 0);
+    if (!e)
+        return 0;
+
+    e->ts_ns = bpf_ktime_get_ns();
+    e->chan = (int)PT_REGS_PARM1(ctx);
+    e->tid = (__u32)PT_REGS_PARM2(ctx);
+    e->spin_ns = (__u64)PT_REGS_PARM3(ctx);
+    e->poll_ns = (__u64)PT_REGS_PARM4(ctx);
+    e->hit = (__u32)PT_REGS_PARM5(ctx);
+    e->pad = 0;
+
+    bpf_ringbuf_submit(e, 0);
+    return 0;
+}
+
+struct {
+    __uint(type, BPF_MAP_TYPE_RINGBUF);
+    __uint(max_entries, 1 << 24);
+} stackfs_batch_events SEC(".maps");
+
+SEC("uprobe/stackfs_batch_probe")
+int up_stackfs_batch_probe(struct pt_regs *ctx)
+{
+    struct stackfs_batch_event *e;
+
+    e = bpf_ringbuf_reserve(&stackfs_batch_events, sizeof(*e), 0);
+    if (!e)
+        return 0;
+
+    e->ts_ns = bpf_ktime_get_ns();
+    e->chan = (int)PT_REGS_PARM1(ctx);
+    e->tid = (__u32)PT_REGS_PARM2(ctx);
+    e->batch = (__u32)PT_REGS_PARM3(ctx);
+    e->pending = (__u32)PT_REGS_PARM4(ctx);
+
+    bpf_ringbuf_submit(e, 0);
+    return 0;
+}
+
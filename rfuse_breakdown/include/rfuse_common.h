@@ -216,4 +216,24 @@ struct rfuse_loop_event {
     __u64 ioctl_postunlock_ns;
 };
 
+/* StackFS --sched_poll_us: one per poll, from stackfs_poll_probe() */
+struct stackfs_poll_event {
+    __u64 ts_ns;
+    __s32 chan;
+    __u32 tid;
+    __u64 spin_ns;      /* time spun */
+    __u64 poll_ns;      /* the adaptive limit it spun under */
+    __u32 hit;          /* 1: found a request, 0: went to sleep */
+    __u32 pad;
+};
+
+/* StackFS --sched_batch: one per batch, from stackfs_batch_probe() */
+struct stackfs_batch_event {
+    __u64 ts_ns;
+    __s32 chan;
+    __u32 tid;
+    __u32 batch;        /* requests taken */
+    __u32 pending;      /* queued on the channel before */
+};
+
 #endif /* __RFUSE_COMMON_H */
@@ -1,297 +0,0 @@
-/* SPDX-License-Identifier: (LGPL-2.1 OR BSD-2-Clause) */
-
-/* THIS FILE IS AUTOGENERATED! */
-#ifndef __RFUSE_LOOP_TRACE_BPF_SKEL_H__
-#define __RFUSE_LOOP_TRACE_BPF_SKEL_H__
-
-#include <errno.h>
-#include <stdlib.h>
-#include <bpf/libbpf.h>
-
-struct rfuse_loop_trace_bpf {
-	struct bpf_object_skeleton *skeleton;
-	struct bpf_object *obj;
-	struct {
-		struct bpf_map *rfuse_loop_events;
-	} maps;
-	struct {
-		struct bpf_program *up_rfuse_latency_probe;
-	} progs;
-	struct {
-		struct bpf_link *up_rfuse_latency_probe;
-	} links;
-};
-
-static void
-rfuse_loop_trace_bpf__destroy(struct rfuse_loop_trace_bpf *obj)
-{
-	if (!obj)
-		return;
-	if (obj->skeleton)
-		bpf_object__destroy_skeleton(obj->skeleton);
-	free(obj);
-}
-
-static inline int
-rfuse_loop_trace_bpf__create_skeleton(struct rfuse_loop_trace_bpf *obj);
-
-static inline struct rfuse_loop_trace_bpf *
-rfuse_loop_trace_bpf__open_opts(const struct bpf_object_open_opts *opts)
-{
-	struct rfuse_loop_trace_bpf *obj;
-	int err;
-
-	obj = (struct rfuse_loop_trace_bpf *)calloc(1, sizeof(*obj));
-	if (!obj) {
-		errno = ENOMEM;
-		return NULL;
-	}
-
-	err = rfuse_loop_trace_bpf__create_skeleton(obj);
-	err = err ?: bpf_object__open_skeleton(obj->skeleton, opts);
-	if (err)
-		goto err_out;
-
-	return obj;
-err_out:
-	rfuse_loop_trace_bpf__destroy(obj);
-	errno = -err;
-	return NULL;
-}
-
-static inline struct rfuse_loop_trace_bpf *
-rfuse_loop_trace_bpf__open(void)
-{
-	return rfuse_loop_trace_bpf__open_opts(NULL);
-}
-
-static inline int
-rfuse_loop_trace_bpf__load(struct rfuse_loop_trace_bpf *obj)
-{
-	return bpf_object__load_skeleton(obj->skeleton);
-}
-
-static inline struct rfuse_loop_trace_bpf *
-rfuse_loop_trace_bpf__open_and_load(void)
-{
-	struct rfuse_loop_trace_bpf *obj;
-	int err;
-
-	obj = rfuse_loop_trace_bpf__open();
-	if (!obj)
-		return NULL;
-	err = rfuse_loop_trace_bpf__load(obj);
-	if (err) {
-		rfuse_loop_trace_bpf__destroy(obj);
-		errno = -err;
-		return NULL;
-	}
-	return obj;
-}
-
-static inline int
-rfuse_loop_trace_bpf__attach(struct rfuse_loop_trace_bpf *obj)
-{
-	return bpf_object__attach_skeleton(obj->skeleton);
-}
-
-static inline void
-rfuse_loop_trace_bpf__detach(struct rfuse_loop_trace_bpf *obj)
-{
-	return bpf_object__detach_skeleton(obj->skeleton);
-}
-
-static inline int
-rfuse_loop_trace_bpf__create_skeleton(struct rfuse_loop_trace_bpf *obj)
-{
-	struct bpf_object_skeleton *s;
-
-	s = (struct bpf_object_skeleton *)calloc(1, sizeof(*s));
-	if (!s)
-		goto err;
-	obj->skeleton = s;
-
-	s->sz = sizeof(*s);
-	s->name = "rfuse_loop_trace_bpf";
-	s->obj = &obj->obj;
-
-	/* maps */
-	s->map_cnt = 1;
-	s->map_skel_sz = sizeof(*s->maps);
-	s->maps = (struct bpf_map_skeleton *)calloc(s->map_cnt, s->map_skel_sz);
-	if (!s->maps)
-		goto err;
-
-	s->maps[0].name = "rfuse_loop_events";
-	s->maps[0].map = &obj->maps.rfuse_loop_events;
-
-	/* programs */
-	s->prog_cnt = 1;
-	s->prog_skel_sz = sizeof(*s->progs);
-	s->progs = (struct bpf_prog_skeleton *)calloc(s->prog_cnt, s->prog_skel_sz);
-	if (!s->progs)
-		goto err;
-
-	s->progs[0].name = "up_rfuse_latency_probe";
-	s->progs[0].prog = &obj->progs.up_rfuse_latency_probe;
-	s->progs[0].link = &obj->links.up_rfuse_latency_probe;
-
-	s->data_sz = 3992;
-	s->data = (void *)"\
-\x7f\x45\x4c\x46\x02\x01\x01\0\0\0\0\0\0\0\0\0\x01\0\xf7\0\x01\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\x58\x0c\0\0\0\0\0\0\0\0\0\0\x40\0\0\0\0\0\x40\0\x0d\0\
-\x01\0\x79\x12\x40\0\0\0\0\0\x7b\x2a\xe8\xff\0\0\0\0\x79\x18\x48\0\0\0\0\0\x79\
-\x17\x58\0\0\0\0\0\x79\x19\x60\0\0\0\0\0\x79\x12\x68\0\0\0\0\0\x7b\x2a\xf0\xff\
-\0\0\0\0\x79\x11\x70\0\0\0\0\0\x7b\x1a\xf8\xff\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\xb7\x02\0\0\x30\0\0\0\xb7\x03\0\0\0\0\0\0\x85\0\0\0\x83\0\0\0\xbf\
-\x06\0\0\0\0\0\0\x15\x06\x0e\0\0\0\0\0\x85\0\0\0\x05\0\0\0\x79\xa1\xe8\xff\0\0\
-\0\0\x7b\x16\x28\0\0\0\0\0\x7b\x86\x20\0\0\0\0\0\x7b\x76\x18\0\0\0\0\0\x7b\x96\
-\x10\0\0\0\0\0\x79\xa1\xf0\xff\0\0\0\0\x63\x16\x0c\0\0\0\0\0\x79\xa1\xf8\xff\0\
-\0\0\0\x63\x16\x08\0\0\0\0\0\x7b\x06\0\0\0\0\0\0\xbf\x61\0\0\0\0\0\0\xb7\x02\0\
-\0\0\0\0\0\x85\0\0\0\x84\0\0\0\xb4\0\0\0\0\0\0\0\x95\0\0\0\0\0\0\0\x47\x50\x4c\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x9f\xeb\x01\0\x18\0\0\0\0\0\0\0\x48\
-\x02\0\0\x48\x02\0\0\xfa\x03\0\0\0\0\0\0\0\0\0\x02\x03\0\0\0\x01\0\0\0\0\0\0\
-\x01\x04\0\0\0\x20\0\0\x01\0\0\0\0\0\0\0\x03\0\0\0\0\x02\0\0\0\x04\0\0\0\x1b\0\
-\0\0\x05\0\0\0\0\0\0\x01\x04\0\0\0\x20\0\0\0\0\0\0\0\0\0\0\x02\x06\0\0\0\0\0\0\
-\0\0\0\0\x03\0\0\0\0\x02\0\0\0\x04\0\0\0\0\0\0\x01\0\0\0\0\x02\0\0\x04\x10\0\0\
-\0\x19\0\0\0\x01\0\0\0\0\0\0\0\x1e\0\0\0\x05\0\0\0\x40\0\0\0\x2a\0\0\0\0\0\0\
-\x0e\x07\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\x02\x0a\0\0\0\x3c\0\0\0\x15\0\0\x04\xa8\
-\0\0\0\x44\0\0\0\x0b\0\0\0\0\0\0\0\x48\0\0\0\x0b\0\0\0\x40\0\0\0\x4c\0\0\0\x0b\
-\0\0\0\x80\0\0\0\x50\0\0\0\x0b\0\0\0\xc0\0\0\0\x54\0\0\0\x0b\0\0\0\0\x01\0\0\
-\x57\0\0\0\x0b\0\0\0\x40\x01\0\0\x5a\0\0\0\x0b\0\0\0\x80\x01\0\0\x5e\0\0\0\x0b\
-\0\0\0\xc0\x01\0\0\x62\0\0\0\x0b\0\0\0\0\x02\0\0\x65\0\0\0\x0b\0\0\0\x40\x02\0\
-\0\x68\0\0\0\x0b\0\0\0\x80\x02\0\0\x6b\0\0\0\x0b\0\0\0\xc0\x02\0\0\x6e\0\0\0\
-\x0b\0\0\0\0\x03\0\0\x71\0\0\0\x0b\0\0\0\x40\x03\0\0\x74\0\0\0\x0b\0\0\0\x80\
-\x03\0\0\x77\0\0\0\x0b\0\0\0\xc0\x03\0\0\x7f\0\0\0\x0b\0\0\0\0\x04\0\0\x82\0\0\
-\0\x0b\0\0\0\x40\x04\0\0\x85\0\0\0\x0b\0\0\0\x80\x04\0\0\x8b\0\0\0\x0b\0\0\0\
-\xc0\x04\0\0\x8e\0\0\0\x0b\0\0\0\0\x05\0\0\x91\0\0\0\0\0\0\x01\x08\0\0\0\x40\0\
-\0\0\0\0\0\0\x01\0\0\x0d\x02\0\0\0\x9f\0\0\0\x09\0\0\0\xa3\0\0\0\x01\0\0\x0c\
-\x0c\0\0\0\xdf\x03\0\0\0\0\0\x01\x01\0\0\0\x08\0\0\x01\0\0\0\0\0\0\0\x03\0\0\0\
-\0\x0e\0\0\0\x04\0\0\0\x04\0\0\0\xe4\x03\0\0\0\0\0\x0e\x0f\0\0\0\x01\0\0\0\xec\
-\x03\0\0\x01\0\0\x0f\0\0\0\0\x08\0\0\0\0\0\0\0\x10\0\0\0\xf2\x03\0\0\x01\0\0\
-\x0f\0\0\0\0\x10\0\0\0\0\0\0\0\x04\0\0\0\0\x69\x6e\x74\0\x5f\x5f\x41\x52\x52\
-\x41\x59\x5f\x53\x49\x5a\x45\x5f\x54\x59\x50\x45\x5f\x5f\0\x74\x79\x70\x65\0\
-\x6d\x61\x78\x5f\x65\x6e\x74\x72\x69\x65\x73\0\x72\x66\x75\x73\x65\x5f\x6c\x6f\
-\x6f\x70\x5f\x65\x76\x65\x6e\x74\x73\0\x70\x74\x5f\x72\x65\x67\x73\0\x72\x31\
-\x35\0\x72\x31\x34\0\x72\x31\x33\0\x72\x31\x32\0\x62\x70\0\x62\x78\0\x72\x31\
-\x31\0\x72\x31\x30\0\x72\x39\0\x72\x38\0\x61\x78\0\x63\x78\0\x64\x78\0\x73\x69\
-\0\x64\x69\0\x6f\x72\x69\x67\x5f\x61\x78\0\x69\x70\0\x63\x73\0\x66\x6c\x61\x67\
-\x73\0\x73\x70\0\x73\x73\0\x75\x6e\x73\x69\x67\x6e\x65\x64\x20\x6c\x6f\x6e\x67\
-\0\x63\x74\x78\0\x75\x70\x5f\x72\x66\x75\x73\x65\x5f\x6c\x61\x74\x65\x6e\x63\
-\x79\x5f\x70\x72\x6f\x62\x65\0\x75\x70\x72\x6f\x62\x65\x2f\x72\x66\x75\x73\x65\
-\x5f\x6c\x61\x74\x65\x6e\x63\x79\x5f\x70\x72\x6f\x62\x65\0\x30\x3a\x38\0\x2f\
-\x68\x6f\x6d\x65\x2f\x6c\x64\x79\x2f\x73\x72\x63\x2f\x6c\x64\x79\x2f\x72\x66\
-\x75\x73\x65\x5f\x62\x72\x65\x61\x6b\x64\x6f\x77\x6e\x2f\x62\x70\x66\x2f\x72\
-\x66\x75\x73\x65\x5f\x6c\x6f\x6f\x70\x5f\x74\x72\x61\x63\x65\x2e\x62\x70\x66\
-\x2e\x63\0\x20\x20\x20\x20\x5f\x5f\x75\x36\x34\x20\x69\x6f\x63\x74\x6c\x5f\x70\
-\x6f\x73\x74\x75\x6e\x6c\x6f\x63\x6b\x5f\x6e\x73\x20\x20\x20\x3d\x20\x28\x5f\
-\x5f\x75\x36\x34\x29\x50\x54\x5f\x52\x45\x47\x53\x5f\x50\x41\x52\x4d\x36\x28\
-\x63\x74\x78\x29\x3b\0\x20\x20\x20\x20\x5f\x5f\x75\x36\x34\x20\x68\x6f\x6c\x64\
-\x5f\x6e\x73\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x3d\
-\x20\x28\x5f\x5f\x75\x36\x34\x29\x50\x54\x5f\x52\x45\x47\x53\x5f\x50\x41\x52\
-\x4d\x35\x28\x63\x74\x78\x29\x3b\0\x30\x3a\x39\0\x30\x3a\x31\x31\0\x20\x20\x20\
-\x20\x5f\x5f\x75\x36\x34\x20\x6c\x6f\x63\x6b\x5f\x77\x61\x69\x74\x5f\x6e\x73\
-\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x3d\x20\x28\x5f\x5f\x75\x36\x34\x29\
-\x50\x54\x5f\x52\x45\x47\x53\x5f\x50\x41\x52\x4d\x34\x28\x63\x74\x78\x29\x3b\0\
-\x30\x3a\x31\x32\0\x20\x20\x20\x20\x5f\x5f\x75\x36\x34\x20\x67\x61\x70\x5f\x6e\
-\x73\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x20\x3d\x20\
-\x28\x5f\x5f\x75\x36\x34\x29\x50\x54\x5f\x52\x45\x47\x53\x5f\x50\x41\x52\x4d\
-\x33\x28\x63\x74\x78\x29\x3b\0\x30\x3a\x31\x33\0\x20\x20\x20\x20\x5f\x5f\x75\
-\x33\x32\x20\x74\x69\x64\x5f\x61\x72\x67\x20\x20\x20\x20\x20\x20\x20\x20\x20\
-\x20\x20\x20\x20\x20\x20\x3d\x20\x28\x5f\x5f\x75\x33\x32\x29\x50\x54\x5f\x52\
-\x45\x47\x53\x5f\x50\x41\x52\x4d\x32\x28\x63\x74\x78\x29\x3b\0\x20\x20\x20\x20\
-\x69\x6e\x74\x20\x72\x69\x71\x5f\x69\x64\x20\x20\x20\x20\x20\x20\x20\x20\x20\
-\x20\x20\x20\x20\x20\x20\x20\x20\x20\x3d\x20\x28\x69\x6e\x74\x29\x50\x54\x5f\
-\x52\x45\x47\x53\x5f\x50\x41\x52\x4d\x31\x28\x63\x74\x78\x29\x3b\0\x30\x3a\x31\
-\x34\0\x20\x20\x20\x20\x65\x20\x3d\x20\x62\x70\x66\x5f\x72\x69\x6e\x67\x62\x75\
-\x66\x5f\x72\x65\x73\x65\x72\x76\x65\x28\x26\x72\x66\x75\x73\x65\x5f\x6c\x6f\
-\x6f\x70\x5f\x65\x76\x65\x6e\x74\x73\x2c\x20\x73\x69\x7a\x65\x6f\x66\x28\x2a\
-\x65\x29\x2c\x20\x30\x29\x3b\0\x20\x20\x20\x20\x69\x66\x20\x28\x21\x65\x29\0\
-\x20\x20\x20\x20\x65\x2d\x3e\x74\x73\x5f\x6e\x73\x20\x3d\x20\x62\x70\x66\x5f\
-\x6b\x74\x69\x6d\x65\x5f\x67\x65\x74\x5f\x6e\x73\x28\x29\x3b\0\x20\x20\x20\x20\
-\x65\x2d\x3e\x69\x6f\x63\x74\x6c\x5f\x70\x6f\x73\x74\x75\x6e\x6c\x6f\x63\x6b\
-\x5f\x6e\x73\x20\x3d\x20\x69\x6f\x63\x74\x6c\x5f\x70\x6f\x73\x74\x75\x6e\x6c\
-\x6f\x63\x6b\x5f\x6e\x73\x3b\0\x20\x20\x20\x20\x65\x2d\x3e\x68\x6f\x6c\x64\x5f\
-\x6e\x73\x20\x3d\x20\x68\x6f\x6c\x64\x5f\x6e\x73\x3b\0\x20\x20\x20\x20\x65\x2d\
-\x3e\x6c\x6f\x63\x6b\x5f\x77\x61\x69\x74\x5f\x6e\x73\x20\x3d\x20\x6c\x6f\x63\
-\x6b\x5f\x77\x61\x69\x74\x5f\x6e\x73\x3b\0\x20\x20\x20\x20\x65\x2d\x3e\x67\x61\
-\x70\x5f\x6e\x73\x20\x3d\x20\x67\x61\x70\x5f\x6e\x73\x3b\0\x20\x20\x20\x20\x65\
-\x2d\x3e\x74\x69\x64\x20\x3d\x20\x74\x69\x64\x5f\x61\x72\x67\x3b\0\x20\x20\x20\
-\x20\x65\x2d\x3e\x72\x69\x71\x5f\x69\x64\x20\x3d\x20\x72\x69\x71\x5f\x69\x64\
-\x3b\0\x20\x20\x20\x20\x62\x70\x66\x5f\x72\x69\x6e\x67\x62\x75\x66\x5f\x73\x75\
-\x62\x6d\x69\x74\x28\x65\x2c\x20\x30\x29\x3b\0\x7d\0\x63\x68\x61\x72\0\x4c\x49\
-\x43\x45\x4e\x53\x45\0\x2e\x6d\x61\x70\x73\0\x6c\x69\x63\x65\x6e\x73\x65\0\0\0\
-\x9f\xeb\x01\0\x20\0\0\0\0\0\0\0\x14\0\0\0\x14\0\0\0\x2c\x01\0\0\x40\x01\0\0\
-\x6c\0\0\0\x08\0\0\0\xba\0\0\0\x01\0\0\0\0\0\0\0\x0d\0\0\0\x10\0\0\0\xba\0\0\0\
-\x12\0\0\0\0\0\0\0\xd9\0\0\0\x16\x01\0\0\x2a\x64\0\0\x08\0\0\0\xd9\0\0\0\x53\
-\x01\0\0\x2a\x60\0\0\x18\0\0\0\xd9\0\0\0\x99\x01\0\0\x2a\x5c\0\0\x20\0\0\0\xd9\
-\0\0\0\xdb\x01\0\0\x2a\x58\0\0\x28\0\0\0\xd9\0\0\0\x1d\x02\0\0\x2a\x54\0\0\x30\
-\0\0\0\xd9\0\0\0\x5a\x02\0\0\x28\x50\0\0\x40\0\0\0\xd9\0\0\0\x9a\x02\0\0\x09\
-\x6c\0\0\x78\0\0\0\xd9\0\0\0\xda\x02\0\0\x09\x70\0\0\x80\0\0\0\xd9\0\0\0\xe6\
-\x02\0\0\x10\x7c\0\0\x88\0\0\0\xd9\0\0\0\x09\x03\0\0\x1c\x94\0\0\x98\0\0\0\xd9\
-\0\0\0\x3b\x03\0\0\x10\x90\0\0\xa0\0\0\0\xd9\0\0\0\x55\x03\0\0\x15\x8c\0\0\xa8\
-\0\0\0\xd9\0\0\0\x79\x03\0\0\x0f\x88\0\0\xb0\0\0\0\xd9\0\0\0\x91\x03\0\0\x0c\
-\x84\0\0\xc0\0\0\0\xd9\0\0\0\xa7\x03\0\0\x0f\x80\0\0\xd0\0\0\0\xd9\0\0\0\xe6\
-\x02\0\0\x0e\x7c\0\0\xd8\0\0\0\xd9\0\0\0\xbf\x03\0\0\x05\x9c\0\0\xf0\0\0\0\xd9\
-\0\0\0\xdd\x03\0\0\x01\xa4\0\0\x10\0\0\0\xba\0\0\0\x06\0\0\0\0\0\0\0\x0a\0\0\0\
-\xd5\0\0\0\0\0\0\0\x10\0\0\0\x0a\0\0\0\x90\x01\0\0\0\0\0\0\x18\0\0\0\x0a\0\0\0\
-\x94\x01\0\0\0\0\0\0\x20\0\0\0\x0a\0\0\0\xd6\x01\0\0\0\0\0\0\x28\0\0\0\x0a\0\0\
-\0\x18\x02\0\0\0\0\0\0\x38\0\0\0\x0a\0\0\0\x95\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\x42\0\0\0\x12\0\x03\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\x14\0\0\0\x11\0\
-\x06\0\0\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\x91\0\0\0\x11\0\x05\0\0\0\0\0\0\0\0\0\
-\x04\0\0\0\0\0\0\0\x48\0\0\0\0\0\0\0\x01\0\0\0\x03\0\0\0\x40\x02\0\0\0\0\0\0\
-\x04\0\0\0\x03\0\0\0\x58\x02\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x2c\0\0\0\0\0\0\0\
-\x04\0\0\0\x01\0\0\0\x40\0\0\0\0\0\0\0\x04\0\0\0\x01\0\0\0\x50\0\0\0\0\0\0\0\
-\x04\0\0\0\x01\0\0\0\x60\0\0\0\0\0\0\0\x04\0\0\0\x01\0\0\0\x70\0\0\0\0\0\0\0\
-\x04\0\0\0\x01\0\0\0\x80\0\0\0\0\0\0\0\x04\0\0\0\x01\0\0\0\x90\0\0\0\0\0\0\0\
-\x04\0\0\0\x01\0\0\0\xa0\0\0\0\0\0\0\0\x04\0\0\0\x01\0\0\0\xb0\0\0\0\0\0\0\0\
-\x04\0\0\0\x01\0\0\0\xc0\0\0\0\0\0\0\0\x04\0\0\0\x01\0\0\0\xd0\0\0\0\0\0\0\0\
-\x04\0\0\0\x01\0\0\0\xe0\0\0\0\0\0\0\0\x04\0\0\0\x01\0\0\0\xf0\0\0\0\0\0\0\0\
-\x04\0\0\0\x01\0\0\0\0\x01\0\0\0\0\0\0\x04\0\0\0\x01\0\0\0\x10\x01\0\0\0\0\0\0\
-\x04\0\0\0\x01\0\0\0\x20\x01\0\0\0\0\0\0\x04\0\0\0\x01\0\0\0\x30\x01\0\0\0\0\0\
-\0\x04\0\0\0\x01\0\0\0\x40\x01\0\0\0\0\0\0\x04\0\0\0\x01\0\0\0\x50\x01\0\0\0\0\
-\0\0\x04\0\0\0\x01\0\0\0\x6c\x01\0\0\0\0\0\0\x04\0\0\0\x01\0\0\0\x7c\x01\0\0\0\
-\0\0\0\x04\0\0\0\x01\0\0\0\x8c\x01\0\0\0\0\0\0\x04\0\0\0\x01\0\0\0\x9c\x01\0\0\
-\0\0\0\0\x04\0\0\0\x01\0\0\0\xac\x01\0\0\0\0\0\0\x04\0\0\0\x01\0\0\0\xbc\x01\0\
-\0\0\0\0\0\x04\0\0\0\x01\0\0\0\x0b\x0d\x0c\0\x2e\x74\x65\x78\x74\0\x2e\x72\x65\
-\x6c\x2e\x42\x54\x46\x2e\x65\x78\x74\0\x72\x66\x75\x73\x65\x5f\x6c\x6f\x6f\x70\
-\x5f\x65\x76\x65\x6e\x74\x73\0\x2e\x6d\x61\x70\x73\0\x2e\x6c\x6c\x76\x6d\x5f\
-\x61\x64\x64\x72\x73\x69\x67\0\x6c\x69\x63\x65\x6e\x73\x65\0\x75\x70\x5f\x72\
-\x66\x75\x73\x65\x5f\x6c\x61\x74\x65\x6e\x63\x79\x5f\x70\x72\x6f\x62\x65\0\x2e\
-\x72\x65\x6c\x75\x70\x72\x6f\x62\x65\x2f\x72\x66\x75\x73\x65\x5f\x6c\x61\x74\
-\x65\x6e\x63\x79\x5f\x70\x72\x6f\x62\x65\0\x2e\x73\x74\x72\x74\x61\x62\0\x2e\
-\x73\x79\x6d\x74\x61\x62\0\x2e\x72\x65\x6c\x2e\x42\x54\x46\0\x4c\x49\x43\x45\
-\x4e\x53\x45\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x78\0\
-\0\0\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xbb\x0b\0\0\0\0\0\0\x99\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\x01\0\0\0\
-\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x40\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x5d\0\0\0\x01\0\0\0\x06\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\x40\0\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x08\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\x59\0\0\0\x09\0\0\0\x40\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\xf8\x09\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\x0c\0\0\0\x03\0\0\0\x08\0\0\0\0\0\0\0\
-\x10\0\0\0\0\0\0\0\x3a\0\0\0\x01\0\0\0\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x40\
-\x01\0\0\0\0\0\0\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\x26\0\0\0\x01\0\0\0\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x48\x01\0\0\0\0\0\
-\0\x10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x8c\0\0\
-\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x58\x01\0\0\0\0\0\0\x5a\x06\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x88\0\0\0\x09\0\0\0\
-\x40\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x08\x0a\0\0\0\0\0\0\x20\0\0\0\0\0\0\0\x0c\0\
-\0\0\x07\0\0\0\x08\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\x0b\0\0\0\x01\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\xb4\x07\0\0\0\0\0\0\xcc\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\x04\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x07\0\0\0\x09\0\0\0\x40\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\x28\x0a\0\0\0\0\0\0\x90\x01\0\0\0\0\0\0\x0c\0\0\0\x09\0\0\0\x08\0\
-\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\x2c\0\0\0\x03\x4c\xff\x6f\0\0\0\x80\0\0\0\0\0\0\
-\0\0\0\0\0\0\xb8\x0b\0\0\0\0\0\0\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\x80\0\0\0\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x80\
-\x09\0\0\0\0\0\0\x78\0\0\0\0\0\0\0\x01\0\0\0\x02\0\0\0\x08\0\0\0\0\0\0\0\x18\0\
-\0\0\0\0\0\0";
-
-	return 0;
-err:
-	bpf_object__destroy_skeleton(s);
-	return -ENOMEM;
-}
-
-#endif /* __RFUSE_LOOP_TRACE_BPF_SKEL_H__ */
@@ -1,873 +0,0 @@
-/* SPDX-License-Identifier: (LGPL-2.1 OR BSD-2-Clause) */
-
-/* THIS FILE IS AUTOGENERATED! */
-#ifndef __RFUSE_TRACE_BPF_SKEL_H__
-#define __RFUSE_TRACE_BPF_SKEL_H__
-
-#include <errno.h>
-#include <stdlib.h>
-#include <bpf/libbpf.h>
-
-struct rfuse_trace_bpf {
-	struct bpf_object_skeleton *skeleton;
-	struct bpf_object *obj;
-	struct {
-		struct bpf_map *pid_alloc_map;
-		struct bpf_map *rfuse_states;
-		struct bpf_map *rfuse_events;
-		struct bpf_map *rfuse_loop_events;
-	} maps;
-	struct {
-		struct bpf_program *kp_rfuse_get_req;
-		struct bpf_program *kp_try_rfuse_get_req;
-		struct bpf_program *kp_rfuse_submit_request;
-		struct bpf_program *up_rfuse_read_request;
-		struct bpf_program *up_rfuse_copy_from_payload_begin_end;
-		struct bpf_program *up_rfuse_copy_to_payload_begin_end;
-		struct bpf_program *up_rfuse_send_result;
-		struct bpf_program *kp_rfuse_request_end;
-	} progs;
-	struct {
-		struct bpf_link *kp_rfuse_get_req;
-		struct bpf_link *kp_try_rfuse_get_req;
-		struct bpf_link *kp_rfuse_submit_request;
-		struct bpf_link *up_rfuse_read_request;
-		struct bpf_link *up_rfuse_copy_from_payload_begin_end;
-		struct bpf_link *up_rfuse_copy_to_payload_begin_end;
-		struct bpf_link *up_rfuse_send_result;
-		struct bpf_link *kp_rfuse_request_end;
-	} links;
-};
-
-static void
-rfuse_trace_bpf__destroy(struct rfuse_trace_bpf *obj)
-{
-	if (!obj)
-		return;
-	if (obj->skeleton)
-		bpf_object__destroy_skeleton(obj->skeleton);
-	free(obj);
-}
-
-static inline int
-rfuse_trace_bpf__create_skeleton(struct rfuse_trace_bpf *obj);
-
-static inline struct rfuse_trace_bpf *
-rfuse_trace_bpf__open_opts(const struct bpf_object_open_opts *opts)
-{
-	struct rfuse_trace_bpf *obj;
-	int err;
-
-	obj = (struct rfuse_trace_bpf *)calloc(1, sizeof(*obj));
-	if (!obj) {
-		errno = ENOMEM;
-		return NULL;
-	}
-
-	err = rfuse_trace_bpf__create_skeleton(obj);
-	err = err ?: bpf_object__open_skeleton(obj->skeleton, opts);
-	if (err)
-		goto err_out;
-
-	return obj;
-err_out:
-	rfuse_trace_bpf__destroy(obj);
-	errno = -err;
-	return NULL;
-}
-
-static inline struct rfuse_trace_bpf *
-rfuse_trace_bpf__open(void)
-{
-	return rfuse_trace_bpf__open_opts(NULL);
-}
-
-static inline int
-rfuse_trace_bpf__load(struct rfuse_trace_bpf *obj)
-{
-	return bpf_object__load_skeleton(obj->skeleton);
-}
-
-static inline struct rfuse_trace_bpf *
-rfuse_trace_bpf__open_and_load(void)
-{
-	struct rfuse_trace_bpf *obj;
-	int err;
-
-	obj = rfuse_trace_bpf__open();
-	if (!obj)
-		return NULL;
-	err = rfuse_trace_bpf__load(obj);
-	if (err) {
-		rfuse_trace_bpf__destroy(obj);
-		errno = -err;
-		return NULL;
-	}
-	return obj;
-}
-
-static inline int
-rfuse_trace_bpf__attach(struct rfuse_trace_bpf *obj)
-{
-	return bpf_object__attach_skeleton(obj->skeleton);
-}
-
-static inline void
-rfuse_trace_bpf__detach(struct rfuse_trace_bpf *obj)
-{
-	return bpf_object__detach_skeleton(obj->skeleton);
-}
-
-static inline int
-rfuse_trace_bpf__create_skeleton(struct rfuse_trace_bpf *obj)
-{
-	struct bpf_object_skeleton *s;
-
-	s = (struct bpf_object_skeleton *)calloc(1, sizeof(*s));
-	if (!s)
-		goto err;
-	obj->skeleton = s;
-
-	s->sz = sizeof(*s);
-	s->name = "rfuse_trace_bpf";
-	s->obj = &obj->obj;
-
-	/* maps */
-	s->map_cnt = 4;
-	s->map_skel_sz = sizeof(*s->maps);
-	s->maps = (struct bpf_map_skeleton *)calloc(s->map_cnt, s->map_skel_sz);
-	if (!s->maps)
-		goto err;
-
-	s->maps[0].name = "pid_alloc_map";
-	s->maps[0].map = &obj->maps.pid_alloc_map;
-
-	s->maps[1].name = "rfuse_states";
-	s->maps[1].map = &obj->maps.rfuse_states;
-
-	s->maps[2].name = "rfuse_events";
-	s->maps[2].map = &obj->maps.rfuse_events;
-
-	s->maps[3].name = "rfuse_loop_events";
-	s->maps[3].map = &obj->maps.rfuse_loop_events;
-
-	/* programs */
-	s->prog_cnt = 8;
-	s->prog_skel_sz = sizeof(*s->progs);
-	s->progs = (struct bpf_prog_skeleton *)calloc(s->prog_cnt, s->prog_skel_sz);
-	if (!s->progs)
-		goto err;
-
-	s->progs[0].name = "kp_rfuse_get_req";
-	s->progs[0].prog = &obj->progs.kp_rfuse_get_req;
-	s->progs[0].link = &obj->links.kp_rfuse_get_req;
-
-	s->progs[1].name = "kp_try_rfuse_get_req";
-	s->progs[1].prog = &obj->progs.kp_try_rfuse_get_req;
-	s->progs[1].link = &obj->links.kp_try_rfuse_get_req;
-
-	s->progs[2].name = "kp_rfuse_submit_request";
-	s->progs[2].prog = &obj->progs.kp_rfuse_submit_request;
-	s->progs[2].link = &obj->links.kp_rfuse_submit_request;
-
-	s->progs[3].name = "up_rfuse_read_request";
-	s->progs[3].prog = &obj->progs.up_rfuse_read_request;
-	s->progs[3].link = &obj->links.up_rfuse_read_request;
-
-	s->progs[4].name = "up_rfuse_copy_from_payload_begin_end";
-	s->progs[4].prog = &obj->progs.up_rfuse_copy_from_payload_begin_end;
-	s->progs[4].link = &obj->links.up_rfuse_copy_from_payload_begin_end;
-
-	s->progs[5].name = "up_rfuse_copy_to_payload_begin_end";
-	s->progs[5].prog = &obj->progs.up_rfuse_copy_to_payload_begin_end;
-	s->progs[5].link = &obj->links.up_rfuse_copy_to_payload_begin_end;
-
-	s->progs[6].name = "up_rfuse_send_result";
-	s->progs[6].prog = &obj->progs.up_rfuse_send_result;
-	s->progs[6].link = &obj->links.up_rfuse_send_result;
-
-	s->progs[7].name = "kp_rfuse_request_end";
-	s->progs[7].prog = &obj->progs.kp_rfuse_request_end;
-	s->progs[7].link = &obj->links.kp_rfuse_request_end;
-
-	s->data_sz = 17584;
-	s->data = (void *)"\
-\x7f\x45\x4c\x46\x02\x01\x01\0\0\0\0\0\0\0\0\0\x01\0\xf7\0\x01\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\x70\x3f\0\0\0\0\0\0\0\0\0\0\x40\0\0\0\0\0\x40\0\x15\0\
-\x01\0\x85\0\0\0\x0e\0\0\0\x63\x0a\xfc\xff\0\0\0\0\x85\0\0\0\x05\0\0\0\x7b\x0a\
-\xf0\xff\0\0\0\0\xbf\xa2\0\0\0\0\0\0\x07\x02\0\0\xfc\xff\xff\xff\xbf\xa3\0\0\0\
-\0\0\0\x07\x03\0\0\xf0\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x04\
-\0\0\0\0\0\0\x85\0\0\0\x02\0\0\0\xb4\0\0\0\0\0\0\0\x95\0\0\0\0\0\0\0\x85\0\0\0\
-\x0e\0\0\0\x63\x0a\xfc\xff\0\0\0\0\x85\0\0\0\x05\0\0\0\x7b\x0a\xf0\xff\0\0\0\0\
-\xbf\xa2\0\0\0\0\0\0\x07\x02\0\0\xfc\xff\xff\xff\xbf\xa3\0\0\0\0\0\0\x07\x03\0\
-\0\xf0\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x04\0\0\0\0\0\0\x85\
-\0\0\0\x02\0\0\0\xb4\0\0\0\0\0\0\0\x95\0\0\0\0\0\0\0\x79\x17\x70\0\0\0\0\0\x79\
-\x18\x68\0\0\0\0\0\x79\x16\x60\0\0\0\0\0\xb7\x09\0\0\0\0\0\0\x7b\x9a\xa0\xff\0\
-\0\0\0\x85\0\0\0\x0e\0\0\0\x63\x6a\xa0\xff\0\0\0\0\x63\x0a\x9c\xff\0\0\0\0\x7b\
-\x8a\xa8\xff\0\0\0\0\xbf\xa2\0\0\0\0\0\0\x07\x02\0\0\xa0\xff\xff\xff\x18\x01\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\x85\0\0\0\x01\0\0\0\xbf\x06\0\0\0\0\0\0\x55\x06\x19\
-\0\0\0\0\0\x7b\x9a\xf8\xff\0\0\0\0\x7b\x9a\xf0\xff\0\0\0\0\x7b\x9a\xe8\xff\0\0\
-\0\0\x7b\x9a\xe0\xff\0\0\0\0\x7b\x9a\xd8\xff\0\0\0\0\x7b\x9a\xd0\xff\0\0\0\0\
-\x7b\x9a\xc8\xff\0\0\0\0\x7b\x9a\xc0\xff\0\0\0\0\x7b\x9a\xb8\xff\0\0\0\0\x7b\
-\x9a\xb0\xff\0\0\0\0\xbf\xa6\0\0\0\0\0\0\x07\x06\0\0\xa0\xff\xff\xff\xbf\xa3\0\
-\0\0\0\0\0\x07\x03\0\0\xb0\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xbf\
-\x62\0\0\0\0\0\0\xb7\x04\0\0\0\0\0\0\x85\0\0\0\x02\0\0\0\x18\x01\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\xbf\x62\0\0\0\0\0\0\x85\0\0\0\x01\0\0\0\xbf\x06\0\0\0\0\0\0\x15\
-\x06\x19\0\0\0\0\0\x79\x61\x18\0\0\0\0\0\x55\x01\x02\0\0\0\0\0\x85\0\0\0\x05\0\
-\0\0\x7b\x06\x18\0\0\0\0\0\x7b\x86\0\0\0\0\0\0\x63\x76\x08\0\0\0\0\0\xbf\xa2\0\
-\0\0\0\0\0\x07\x02\0\0\x9c\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x85\
-\0\0\0\x01\0\0\0\x15\0\x0b\0\0\0\0\0\x79\x01\0\0\0\0\0\0\x79\x62\x18\0\0\0\0\0\
-\xbd\x12\x02\0\0\0\0\0\x1f\x12\0\0\0\0\0\0\x7b\x26\x48\0\0\0\0\0\xbf\xa2\0\0\0\
-\0\0\0\x07\x02\0\0\x9c\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x85\0\0\
-\0\x03\0\0\0\x05\0\x02\0\0\0\0\0\xb7\x01\0\0\0\0\0\0\x7b\x16\x48\0\0\0\0\0\xb4\
-\0\0\0\0\0\0\0\x95\0\0\0\0\0\0\0\x79\x12\x70\0\0\0\0\0\x7b\x2a\x98\xff\0\0\0\0\
-\x79\x19\x68\0\0\0\0\0\x79\x18\x60\0\0\0\0\0\x85\0\0\0\x0e\0\0\0\xbf\x06\0\0\0\
-\0\0\0\xb7\x07\0\0\0\0\0\0\x7b\x7a\xa0\xff\0\0\0\0\x63\x8a\xa0\xff\0\0\0\0\x7b\
-\x9a\xa8\xff\0\0\0\0\xbf\xa2\0\0\0\0\0\0\x07\x02\0\0\xa0\xff\xff\xff\x18\x01\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\x85\0\0\0\x01\0\0\0\x55\0\x18\0\0\0\0\0\x7b\x7a\xf8\
-\xff\0\0\0\0\x7b\x7a\xf0\xff\0\0\0\0\x7b\x7a\xe8\xff\0\0\0\0\x7b\x7a\xe0\xff\0\
-\0\0\0\x7b\x7a\xd8\xff\0\0\0\0\x7b\x7a\xd0\xff\0\0\0\0\x7b\x7a\xc8\xff\0\0\0\0\
-\x7b\x7a\xc0\xff\0\0\0\0\x7b\x7a\xb8\xff\0\0\0\0\x7b\x7a\xb0\xff\0\0\0\0\xbf\
-\xa7\0\0\0\0\0\0\x07\x07\0\0\xa0\xff\xff\xff\xbf\xa3\0\0\0\0\0\0\x07\x03\0\0\
-\xb0\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xbf\x72\0\0\0\0\0\0\xb7\
-\x04\0\0\0\0\0\0\x85\0\0\0\x02\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xbf\
-\x72\0\0\0\0\0\0\x85\0\0\0\x01\0\0\0\x15\0\x0b\0\0\0\0\0\x79\x01\x20\0\0\0\0\0\
-\x55\x01\x05\0\0\0\0\0\xbf\x07\0\0\0\0\0\0\x85\0\0\0\x05\0\0\0\xbf\x01\0\0\0\0\
-\0\0\xbf\x70\0\0\0\0\0\0\x7b\x10\x20\0\0\0\0\0\x63\x60\x0c\0\0\0\0\0\x7b\x90\0\
-\0\0\0\0\0\x79\xa1\x98\xff\0\0\0\0\x63\x10\x08\0\0\0\0\0\xb4\0\0\0\0\0\0\0\x95\
-\0\0\0\0\0\0\0\x79\x18\x58\0\0\0\0\0\x79\x17\x70\0\0\0\0\0\x79\x19\x68\0\0\0\0\
-\0\x79\x11\x60\0\0\0\0\0\xb7\x06\0\0\0\0\0\0\x7b\x6a\xa0\xff\0\0\0\0\x63\x1a\
-\xa0\xff\0\0\0\0\x7b\x9a\xa8\xff\0\0\0\0\xbf\xa2\0\0\0\0\0\0\x07\x02\0\0\xa0\
-\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x85\0\0\0\x01\0\0\0\x55\0\x18\
-\0\0\0\0\0\x7b\x6a\xf8\xff\0\0\0\0\x7b\x6a\xf0\xff\0\0\0\0\x7b\x6a\xe8\xff\0\0\
-\0\0\x7b\x6a\xe0\xff\0\0\0\0\x7b\x6a\xd8\xff\0\0\0\0\x7b\x6a\xd0\xff\0\0\0\0\
-\x7b\x6a\xc8\xff\0\0\0\0\x7b\x6a\xc0\xff\0\0\0\0\x7b\x6a\xb8\xff\0\0\0\0\x7b\
-\x6a\xb0\xff\0\0\0\0\xbf\xa6\0\0\0\0\0\0\x07\x06\0\0\xa0\xff\xff\xff\xbf\xa3\0\
-\0\0\0\0\0\x07\x03\0\0\xb0\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xbf\
-\x62\0\0\0\0\0\0\xb7\x04\0\0\0\0\0\0\x85\0\0\0\x02\0\0\0\x18\x01\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\xbf\x62\0\0\0\0\0\0\x85\0\0\0\x01\0\0\0\x15\0\x03\0\0\0\0\0\x7b\
-\x80\x38\0\0\0\0\0\x7b\x90\0\0\0\0\0\0\x63\x70\x08\0\0\0\0\0\xb4\0\0\0\0\0\0\0\
-\x95\0\0\0\0\0\0\0\x79\x18\x58\0\0\0\0\0\x79\x17\x70\0\0\0\0\0\x79\x19\x68\0\0\
-\0\0\0\x79\x11\x60\0\0\0\0\0\xb7\x06\0\0\0\0\0\0\x7b\x6a\xa0\xff\0\0\0\0\x63\
-\x1a\xa0\xff\0\0\0\0\x7b\x9a\xa8\xff\0\0\0\0\xbf\xa2\0\0\0\0\0\0\x07\x02\0\0\
-\xa0\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x85\0\0\0\x01\0\0\0\x55\0\
-\x18\0\0\0\0\0\x7b\x6a\xf8\xff\0\0\0\0\x7b\x6a\xf0\xff\0\0\0\0\x7b\x6a\xe8\xff\
-\0\0\0\0\x7b\x6a\xe0\xff\0\0\0\0\x7b\x6a\xd8\xff\0\0\0\0\x7b\x6a\xd0\xff\0\0\0\
-\0\x7b\x6a\xc8\xff\0\0\0\0\x7b\x6a\xc0\xff\0\0\0\0\x7b\x6a\xb8\xff\0\0\0\0\x7b\
-\x6a\xb0\xff\0\0\0\0\xbf\xa6\0\0\0\0\0\0\x07\x06\0\0\xa0\xff\xff\xff\xbf\xa3\0\
-\0\0\0\0\0\x07\x03\0\0\xb0\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xbf\
-\x62\0\0\0\0\0\0\xb7\x04\0\0\0\0\0\0\x85\0\0\0\x02\0\0\0\x18\x01\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\xbf\x62\0\0\0\0\0\0\x85\0\0\0\x01\0\0\0\x15\0\x03\0\0\0\0\0\x7b\
-\x80\x40\0\0\0\0\0\x7b\x90\0\0\0\0\0\0\x63\x70\x08\0\0\0\0\0\xb4\0\0\0\0\0\0\0\
-\x95\0\0\0\0\0\0\0\x79\x17\x70\0\0\0\0\0\x79\x18\x68\0\0\0\0\0\x79\x11\x60\0\0\
-\0\0\0\xb7\x09\0\0\0\0\0\0\x7b\x9a\xa0\xff\0\0\0\0\x63\x1a\xa0\xff\0\0\0\0\x7b\
-\x8a\xa8\xff\0\0\0\0\xbf\xa2\0\0\0\0\0\0\x07\x02\0\0\xa0\xff\xff\xff\x18\x01\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\x85\0\0\0\x01\0\0\0\xbf\x06\0\0\0\0\0\0\x55\x06\x19\
-\0\0\0\0\0\x7b\x9a\xf8\xff\0\0\0\0\x7b\x9a\xf0\xff\0\0\0\0\x7b\x9a\xe8\xff\0\0\
-\0\0\x7b\x9a\xe0\xff\0\0\0\0\x7b\x9a\xd8\xff\0\0\0\0\x7b\x9a\xd0\xff\0\0\0\0\
-\x7b\x9a\xc8\xff\0\0\0\0\x7b\x9a\xc0\xff\0\0\0\0\x7b\x9a\xb8\xff\0\0\0\0\x7b\
-\x9a\xb0\xff\0\0\0\0\xbf\xa6\0\0\0\0\0\0\x07\x06\0\0\xa0\xff\xff\xff\xbf\xa3\0\
-\0\0\0\0\0\x07\x03\0\0\xb0\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xbf\
-\x62\0\0\0\0\0\0\xb7\x04\0\0\0\0\0\0\x85\0\0\0\x02\0\0\0\x18\x01\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\xbf\x62\0\0\0\0\0\0\x85\0\0\0\x01\0\0\0\xbf\x06\0\0\0\0\0\0\x15\
-\x06\x04\0\0\0\0\0\x85\0\0\0\x05\0\0\0\x7b\x06\x28\0\0\0\0\0\x63\x76\x08\0\0\0\
-\0\0\x7b\x86\0\0\0\0\0\0\xb4\0\0\0\0\0\0\0\x95\0\0\0\0\0\0\0\x79\x17\x70\0\0\0\
-\0\0\xb7\x01\0\0\0\0\0\0\x7b\x1a\xf0\xff\0\0\0\0\xb4\x02\0\0\0\0\0\0\x63\x2a\
-\xec\xff\0\0\0\0\x7b\x1a\xe0\xff\0\0\0\0\x85\0\0\0\x05\0\0\0\xbf\x06\0\0\0\0\0\
-\0\x15\x07\x63\0\0\0\0\0\xbf\x73\0\0\0\0\0\0\x07\x03\0\0\x44\0\0\0\xbf\xa1\0\0\
-\0\0\0\0\x07\x01\0\0\xec\xff\xff\xff\xb4\x02\0\0\x04\0\0\0\x85\0\0\0\x71\0\0\0\
-\xbf\xa1\0\0\0\0\0\0\x07\x01\0\0\xe0\xff\xff\xff\xb4\x02\0\0\x08\0\0\0\xbf\x73\
-\0\0\0\0\0\0\x85\0\0\0\x71\0\0\0\x61\xa1\xec\xff\0\0\0\0\x63\x1a\xf0\xff\0\0\0\
-\0\x79\xa1\xe0\xff\0\0\0\0\x7b\x1a\xf8\xff\0\0\0\0\xbf\xa2\0\0\0\0\0\0\x07\x02\
-\0\0\xf0\xff\xff\xff\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x85\0\0\0\x01\0\0\0\
-\xbf\x07\0\0\0\0\0\0\x15\x07\x4d\0\0\0\0\0\x7b\x67\x30\0\0\0\0\0\x79\x71\x20\0\
-\0\0\0\0\x79\x72\x18\0\0\0\0\0\x15\x02\x0b\0\0\0\0\0\x55\x01\x05\0\0\0\0\0\xb7\
-\x01\0\0\0\0\0\0\x7b\x1a\xd8\xff\0\0\0\0\x79\x73\x28\0\0\0\0\0\xb7\x09\0\0\0\0\
-\0\0\x05\0\x11\0\0\0\0\0\xbf\x13\0\0\0\0\0\0\x1f\x23\0\0\0\0\0\0\x7b\x3a\xd8\
-\xff\0\0\0\0\x79\x72\x28\0\0\0\0\0\x05\0\x06\0\0\0\0\0\xb7\x02\0\0\0\0\0\0\x7b\
-\x2a\xd8\xff\0\0\0\0\x79\x72\x28\0\0\0\0\0\xbf\x23\0\0\0\0\0\0\xb7\x09\0\0\0\0\
-\0\0\x15\x01\x06\0\0\0\0\0\xb7\x03\0\0\0\0\0\0\xb7\x09\0\0\0\0\0\0\x15\x02\x03\
-\0\0\0\0\0\xbf\x29\0\0\0\0\0\0\x1f\x19\0\0\0\0\0\0\xbf\x23\0\0\0\0\0\0\x7b\x3a\
-\xd0\xff\0\0\0\0\x18\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb7\x02\0\0\x60\0\0\0\xb7\
-\x03\0\0\0\0\0\0\x85\0\0\0\x83\0\0\0\xbf\x08\0\0\0\0\0\0\x15\x08\x25\0\0\0\0\0\
-\x79\x71\x18\0\0\0\0\0\x7b\x18\0\0\0\0\0\0\x61\xa1\xf0\xff\0\0\0\0\xb4\x02\0\0\
-\0\0\0\0\x63\x28\x0c\0\0\0\0\0\x63\x18\x08\0\0\0\0\0\x79\x71\0\0\0\0\0\0\x7b\
-\x18\x10\0\0\0\0\0\x61\x71\x08\0\0\0\0\0\x63\x18\x18\0\0\0\0\0\x61\x71\x0c\0\0\
-\0\0\0\x63\x18\x1c\0\0\0\0\0\xbf\x81\0\0\0\0\0\0\x07\x01\0\0\x20\0\0\0\xb4\x02\
-\0\0\x10\0\0\0\x85\0\0\0\x10\0\0\0\xb7\x02\0\0\0\0\0\0\x79\xa3\xd0\xff\0\0\0\0\
-\x15\x06\x02\0\0\0\0\0\x1f\x36\0\0\0\0\0\0\xbf\x62\0\0\0\0\0\0\xb7\x01\0\0\0\0\
-\0\0\x15\x03\x01\0\0\0\0\0\xbf\x21\0\0\0\0\0\0\x79\x72\x48\0\0\0\0\0\x7b\x28\
-\x58\0\0\0\0\0\x79\xa2\xd8\xff\0\0\0\0\x7b\x28\x30\0\0\0\0\0\x7b\x98\x38\0\0\0\
-\0\0\x7b\x18\x40\0\0\0\0\0\x79\x71\x38\0\0\0\0\0\x7b\x18\x48\0\0\0\0\0\x79\x71\
-\x40\0\0\0\0\0\x7b\x18\x50\0\0\0\0\0\xbf\x81\0\0\0\0\0\0\xb7\x02\0\0\0\0\0\0\
-\x85\0\0\0\x84\0\0\0\xbf\xa2\0\0\0\0\0\0\x07\x02\0\0\xf0\xff\xff\xff\x18\x01\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\x85\0\0\0\x03\0\0\0\xb4\0\0\0\0\0\0\0\x95\0\0\0\0\0\
-\0\0\x47\x50\x4c\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x9f\xeb\x01\0\
-\x18\0\0\0\0\0\0\0\xd0\x05\0\0\xd0\x05\0\0\x42\x0f\0\0\0\0\0\0\0\0\0\x02\x03\0\
-\0\0\x01\0\0\0\0\0\0\x01\x04\0\0\0\x20\0\0\x01\0\0\0\0\0\0\0\x03\0\0\0\0\x02\0\
-\0\0\x04\0\0\0\x01\0\0\0\x05\0\0\0\0\0\0\x01\x04\0\0\0\x20\0\0\0\0\0\0\0\0\0\0\
-\x02\x06\0\0\0\0\0\0\0\0\0\0\x03\0\0\0\0\x02\0\0\0\x04\0\0\0\0\x28\0\0\0\0\0\0\
-\0\0\0\x02\x08\0\0\0\x19\0\0\0\0\0\0\x08\x09\0\0\0\x1f\0\0\0\0\0\0\x01\x04\0\0\
-\0\x20\0\0\0\0\0\0\0\0\0\0\x02\x0b\0\0\0\x2c\0\0\0\0\0\0\x08\x0c\0\0\0\x32\0\0\
-\0\0\0\0\x01\x08\0\0\0\x40\0\0\0\0\0\0\0\x04\0\0\x04\x20\0\0\0\x45\0\0\0\x01\0\
-\0\0\0\0\0\0\x4a\0\0\0\x05\0\0\0\x40\0\0\0\x56\0\0\0\x07\0\0\0\x80\0\0\0\x5a\0\
-\0\0\x0a\0\0\0\xc0\0\0\0\x60\0\0\0\0\0\0\x0e\x0d\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\
-\x02\x10\0\0\0\0\0\0\0\0\0\0\x03\0\0\0\0\x02\0\0\0\x04\0\0\0\0\0\x01\0\0\0\0\0\
-\0\0\0\x02\x12\0\0\0\x6e\0\0\0\x02\0\0\x04\x10\0\0\0\x7c\0\0\0\x02\0\0\0\0\0\0\
-\0\x83\0\0\0\x13\0\0\0\x40\0\0\0\x8a\0\0\0\0\0\0\x08\x14\0\0\0\x93\0\0\0\0\0\0\
-\x08\x0b\0\0\0\0\0\0\0\0\0\0\x02\x16\0\0\0\x97\0\0\0\x0b\0\0\x04\x50\0\0\0\x83\
-\0\0\0\x13\0\0\0\0\0\0\0\xa7\0\0\0\x17\0\0\0\x40\0\0\0\xae\0\0\0\x17\0\0\0\x60\
-\0\0\0\xb2\0\0\0\x17\0\0\0\x80\0\0\0\xb8\0\0\0\x13\0\0\0\xc0\0\0\0\xc5\0\0\0\
-\x13\0\0\0\0\x01\0\0\xd4\0\0\0\x13\0\0\0\x40\x01\0\0\xe6\0\0\0\x13\0\0\0\x80\
-\x01\0\0\xf0\0\0\0\x13\0\0\0\xc0\x01\0\0\x05\x01\0\0\x13\0\0\0\0\x02\0\0\x18\
-\x01\0\0\x13\0\0\0\x40\x02\0\0\x27\x01\0\0\0\0\0\x08\x18\0\0\0\x30\x01\0\0\0\0\
-\0\x08\x08\0\0\0\0\0\0\0\x04\0\0\x04\x20\0\0\0\x45\0\0\0\x01\0\0\0\0\0\0\0\x4a\
-\0\0\0\x0f\0\0\0\x40\0\0\0\x56\0\0\0\x11\0\0\0\x80\0\0\0\x5a\0\0\0\x15\0\0\0\
-\xc0\0\0\0\x34\x01\0\0\0\0\0\x0e\x19\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\x02\x1c\0\0\
-\0\0\0\0\0\0\0\0\x03\0\0\0\0\x02\0\0\0\x04\0\0\0\x1b\0\0\0\0\0\0\0\0\0\0\x02\
-\x1e\0\0\0\0\0\0\0\0\0\0\x03\0\0\0\0\x02\0\0\0\x04\0\0\0\0\0\0\x01\0\0\0\0\x02\
-\0\0\x04\x10\0\0\0\x45\0\0\0\x1b\0\0\0\0\0\0\0\x4a\0\0\0\x1d\0\0\0\x40\0\0\0\
-\x41\x01\0\0\0\0\0\x0e\x1f\0\0\0\x01\0\0\0\0\0\0\0\x02\0\0\x04\x10\0\0\0\x45\0\
-\0\0\x1b\0\0\0\0\0\0\0\x4a\0\0\0\x1d\0\0\0\x40\0\0\0\x4e\x01\0\0\0\0\0\x0e\x21\
-\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\x02\x24\0\0\0\x60\x01\0\0\x15\0\0\x04\xa8\0\0\0\
-\x68\x01\0\0\x25\0\0\0\0\0\0\0\x6c\x01\0\0\x25\0\0\0\x40\0\0\0\x70\x01\0\0\x25\
-\0\0\0\x80\0\0\0\x74\x01\0\0\x25\0\0\0\xc0\0\0\0\x78\x01\0\0\x25\0\0\0\0\x01\0\
-\0\x7b\x01\0\0\x25\0\0\0\x40\x01\0\0\x7e\x01\0\0\x25\0\0\0\x80\x01\0\0\x82\x01\
-\0\0\x25\0\0\0\xc0\x01\0\0\x86\x01\0\0\x25\0\0\0\0\x02\0\0\x89\x01\0\0\x25\0\0\
-\0\x40\x02\0\0\x8c\x01\0\0\x25\0\0\0\x80\x02\0\0\x8f\x01\0\0\x25\0\0\0\xc0\x02\
-\0\0\x92\x01\0\0\x25\0\0\0\0\x03\0\0\x95\x01\0\0\x25\0\0\0\x40\x03\0\0\x98\x01\
-\0\0\x25\0\0\0\x80\x03\0\0\x9b\x01\0\0\x25\0\0\0\xc0\x03\0\0\xa3\x01\0\0\x25\0\
-\0\0\0\x04\0\0\xa6\x01\0\0\x25\0\0\0\x40\x04\0\0\xb2\0\0\0\x25\0\0\0\x80\x04\0\
-\0\xa9\x01\0\0\x25\0\0\0\xc0\x04\0\0\xac\x01\0\0\x25\0\0\0\0\x05\0\0\xaf\x01\0\
-\0\0\0\0\x01\x08\0\0\0\x40\0\0\0\0\0\0\0\x01\0\0\x0d\x02\0\0\0\xbd\x01\0\0\x23\
-\0\0\0\xc1\x01\0\0\x01\0\0\x0c\x26\0\0\0\0\0\0\0\x01\0\0\x0d\x02\0\0\0\xbd\x01\
-\0\0\x23\0\0\0\xc0\x02\0\0\x01\0\0\x0c\x28\0\0\0\0\0\0\0\x01\0\0\x0d\x02\0\0\0\
-\xbd\x01\0\0\x23\0\0\0\xee\x02\0\0\x01\0\0\x0c\x2a\0\0\0\0\0\0\0\x01\0\0\x0d\
-\x02\0\0\0\xbd\x01\0\0\x23\0\0\0\xa4\x06\0\0\x01\0\0\x0c\x2c\0\0\0\0\0\0\0\x01\
-\0\0\x0d\x02\0\0\0\xbd\x01\0\0\x23\0\0\0\xe3\x07\0\0\x01\0\0\x0c\x2e\0\0\0\0\0\
-\0\0\x01\0\0\x0d\x02\0\0\0\xbd\x01\0\0\x23\0\0\0\x02\x09\0\0\x01\0\0\x0c\x30\0\
-\0\0\0\0\0\0\x01\0\0\x0d\x02\0\0\0\xbd\x01\0\0\x23\0\0\0\x4e\x09\0\0\x01\0\0\
-\x0c\x32\0\0\0\0\0\0\0\x01\0\0\x0d\x02\0\0\0\xbd\x01\0\0\x23\0\0\0\x93\x09\0\0\
-\x01\0\0\x0c\x34\0\0\0\x27\x0f\0\0\0\0\0\x01\x01\0\0\0\x08\0\0\x01\0\0\0\0\0\0\
-\0\x03\0\0\0\0\x36\0\0\0\x04\0\0\0\x04\0\0\0\x2c\x0f\0\0\0\0\0\x0e\x37\0\0\0\
-\x01\0\0\0\x34\x0f\0\0\x04\0\0\x0f\0\0\0\0\x0e\0\0\0\0\0\0\0\x20\0\0\0\x1a\0\0\
-\0\0\0\0\0\x20\0\0\0\x20\0\0\0\0\0\0\0\x10\0\0\0\x22\0\0\0\0\0\0\0\x10\0\0\0\
-\x3a\x0f\0\0\x01\0\0\x0f\0\0\0\0\x38\0\0\0\0\0\0\0\x04\0\0\0\0\x69\x6e\x74\0\
-\x5f\x5f\x41\x52\x52\x41\x59\x5f\x53\x49\x5a\x45\x5f\x54\x59\x50\x45\x5f\x5f\0\
-\x5f\x5f\x75\x33\x32\0\x75\x6e\x73\x69\x67\x6e\x65\x64\x20\x69\x6e\x74\0\x5f\
-\x5f\x75\x36\x34\0\x75\x6e\x73\x69\x67\x6e\x65\x64\x20\x6c\x6f\x6e\x67\x20\x6c\
-\x6f\x6e\x67\0\x74\x79\x70\x65\0\x6d\x61\x78\x5f\x65\x6e\x74\x72\x69\x65\x73\0\
-\x6b\x65\x79\0\x76\x61\x6c\x75\x65\0\x70\x69\x64\x5f\x61\x6c\x6c\x6f\x63\x5f\
-\x6d\x61\x70\0\x72\x66\x75\x73\x65\x5f\x72\x65\x71\x5f\x6b\x65\x79\0\x72\x69\
-\x71\x5f\x69\x64\0\x75\x6e\x69\x71\x75\x65\0\x75\x69\x6e\x74\x36\x34\x5f\x74\0\
-\x75\x36\x34\0\x72\x66\x75\x73\x65\x5f\x72\x65\x71\x5f\x73\x74\x61\x74\x65\0\
-\x6f\x70\x63\x6f\x64\x65\0\x70\x69\x64\0\x66\x6c\x61\x67\x73\0\x74\x73\x5f\x71\
-\x75\x65\x75\x65\x64\x5f\x6e\x73\0\x74\x73\x5f\x64\x65\x71\x75\x65\x75\x65\x64\
-\x5f\x6e\x73\0\x74\x73\x5f\x64\x61\x65\x6d\x6f\x6e\x5f\x64\x6f\x6e\x65\x5f\x6e\
-\x73\0\x74\x73\x5f\x65\x6e\x64\x5f\x6e\x73\0\x63\x6f\x70\x79\x5f\x66\x72\x6f\
-\x6d\x5f\x6c\x61\x74\x65\x6e\x63\x79\x5f\x6e\x73\0\x63\x6f\x70\x79\x5f\x74\x6f\
-\x5f\x6c\x61\x74\x65\x6e\x63\x79\x5f\x6e\x73\0\x61\x6c\x6c\x6f\x63\x5f\x64\x65\
-\x6c\x61\x79\x5f\x6e\x73\0\x75\x69\x6e\x74\x33\x32\x5f\x74\0\x75\x33\x32\0\x72\
-\x66\x75\x73\x65\x5f\x73\x74\x61\x74\x65\x73\0\x72\x66\x75\x73\x65\x5f\x65\x76\
-\x65\x6e\x74\x73\0\x72\x66\x75\x73\x65\x5f\x6c\x6f\x6f\x70\x5f\x65\x76\x65\x6e\
-\x74\x73\0\x70\x74\x5f\x72\x65\x67\x73\0\x72\x31\x35\0\x72\x31\x34\0\x72\x31\
-\x33\0\x72\x31\x32\0\x62\x70\0\x62\x78\0\x72\x31\x31\0\x72\x31\x30\0\x72\x39\0\
-\x72\x38\0\x61\x78\0\x63\x78\0\x64\x78\0\x73\x69\0\x64\x69\0\x6f\x72\x69\x67\
-\x5f\x61\x78\0\x69\x70\0\x63\x73\0\x73\x70\0\x73\x73\0\x75\x6e\x73\x69\x67\x6e\
-\x65\x64\x20\x6c\x6f\x6e\x67\0\x63\x74\x78\0\x6b\x70\x5f\x72\x66\x75\x73\x65\
-\x5f\x67\x65\x74\x5f\x72\x65\x71\0\x6b\x70\x72\x6f\x62\x65\x2f\x72\x66\x75\x73\
-\x65\x5f\x67\x65\x74\x5f\x72\x65\x71\0\x2f\x68\x6f\x6d\x65\x2f\x6c\x64\x79\x2f\
-\x73\x72\x63\x2f\x6c\x64\x79\x2f\x72\x66\x75\x73\x65\x5f\x62\x72\x65\x61\x6b\
-\x64\x6f\x77\x6e\x2f\x62\x70\x66\x2f\x72\x66\x75\x73\x65\x5f\x74\x72\x61\x63\
-\x65\x2e\x62\x70\x66\x2e\x63\0\x20\x20\x20\x20\x5f\x5f\x75\x33\x32\x20\x74\x69\
-\x64\x20\x3d\x20\x28\x5f\x5f\x75\x33\x32\x29\x62\x70\x66\x5f\x67\x65\x74\x5f\
-\x63\x75\x72\x72\x65\x6e\x74\x5f\x70\x69\x64\x5f\x74\x67\x69\x64\x28\x29\x3b\0\
-\x20\x20\x20\x20\x5f\x5f\x75\x36\x34\x20\x74\x73\x20\x3d\x20\x62\x70\x66\x5f\
-\x6b\x74\x69\x6d\x65\x5f\x67\x65\x74\x5f\x6e\x73\x28\x29\x3b\0\x20\x20\x20\x20\
-\x62\x70\x66\x5f\x6d\x61\x70\x5f\x75\x70\x64\x61\x74\x65\x5f\x65\x6c\x65\x6d\
-\x28\x26\x70\x69\x64\x5f\x61\x6c\x6c\x6f\x63\x5f\x6d\x61\x70\x2c\x20\x26\x74\
-\x69\x64\x2c\x20\x26\x74\x73\x2c\x20\x42\x50\x46\x5f\x41\x4e\x59\x29\x3b\0\x20\
-\x20\x20\x20\x72\x65\x74\x75\x72\x6e\x20\x30\x3b\0\x6b\x70\x5f\x74\x72\x79\x5f\
-\x72\x66\x75\x73\x65\x5f\x67\x65\x74\x5f\x72\x65\x71\0\x6b\x70\x72\x6f\x62\x65\
-\x2f\x74\x72\x79\x5f\x72\x66\x75\x73\x65\x5f\x67\x65\x74\x5f\x72\x65\x71\0\x6b\
-\x70\x5f\x72\x66\x75\x73\x65\x5f\x73\x75\x62\x6d\x69\x74\x5f\x72\x65\x71\x75\
-\x65\x73\x74\0\x6b\x70\x72\x6f\x62\x65\x2f\x72\x66\x75\x73\x65\x5f\x73\x75\x62\
-\x6d\x69\x74\x5f\x72\x65\x71\x75\x65\x73\x74\0\x30\x3a\x31\x34\0\x20\x20\x20\
-\x20\x5f\x5f\x75\x33\x32\x20\x6f\x70\x63\x6f\x64\x65\x20\x20\x20\x20\x20\x3d\
-\x20\x28\x5f\x5f\x75\x33\x32\x29\x50\x54\x5f\x52\x45\x47\x53\x5f\x50\x41\x52\
-\x4d\x31\x28\x63\x74\x78\x29\x3b\0\x30\x3a\x31\x33\0\x20\x20\x20\x20\x5f\x5f\
-\x75\x36\x34\x20\x75\x6e\x69\x71\x75\x65\x20\x20\x20\x20\x20\x3d\x20\x28\x5f\
-\x5f\x75\x36\x34\x29\x50\x54\x5f\x52\x45\x47\x53\x5f\x50\x41\x52\x4d\x32\x28\
-\x63\x74\x78\x29\x3b\0\x30\x3a\x31\x32\0\x20\x20\x20\x20\x69\x6e\x74\x20\x20\
-\x20\x72\x69\x71\x5f\x69\x64\x20\x20\x20\x20\x20\x3d\x20\x28\x69\x6e\x74\x29\
-\x50\x54\x5f\x52\x45\x47\x53\x5f\x50\x41\x52\x4d\x33\x28\x63\x74\x78\x29\x3b\0\
-\x20\x20\x20\x20\x73\x74\x72\x75\x63\x74\x20\x72\x66\x75\x73\x65\x5f\x72\x65\
-\x71\x5f\x6b\x65\x79\x20\x6b\x65\x79\x20\x3d\x20\x7b\x7d\x3b\0\x20\x20\x20\x20\
-\x6b\x65\x79\x2e\x72\x69\x71\x5f\x69\x64\x20\x3d\x20\x72\x69\x71\x5f\x69\x64\
-\x3b\0\x20\x20\x20\x20\x6b\x65\x79\x2e\x75\x6e\x69\x71\x75\x65\x20\x3d\x20\x75\
-\x6e\x69\x71\x75\x65\x3b\0\x20\x20\x20\x20\x73\x74\x20\x3d\x20\x62\x70\x66\x5f\
-\x6d\x61\x70\x5f\x6c\x6f\x6f\x6b\x75\x70\x5f\x65\x6c\x65\x6d\x28\x26\x72\x66\
-\x75\x73\x65\x5f\x73\x74\x61\x74\x65\x73\x2c\x20\x6b\x65\x79\x29\x3b\0\x20\x20\
-\x20\x20\x69\x66\x20\x28\x73\x74\x29\0\x20\x20\x20\x20\x73\x74\x72\x75\x63\x74\
-\x20\x72\x66\x75\x73\x65\x5f\x72\x65\x71\x5f\x73\x74\x61\x74\x65\x20\x7a\x65\
-\x72\x6f\x20\x3d\x20\x7b\x7d\x3b\0\x20\x20\x20\x20\x62\x70\x66\x5f\x6d\x61\x70\
-\x5f\x75\x70\x64\x61\x74\x65\x5f\x65\x6c\x65\x6d\x28\x26\x72\x66\x75\x73\x65\
-\x5f\x73\x74\x61\x74\x65\x73\x2c\x20\x6b\x65\x79\x2c\x20\x26\x7a\x65\x72\x6f\
-\x2c\x20\x42\x50\x46\x5f\x41\x4e\x59\x29\x3b\0\x20\x20\x20\x20\x72\x65\x74\x75\
-\x72\x6e\x20\x62\x70\x66\x5f\x6d\x61\x70\x5f\x6c\x6f\x6f\x6b\x75\x70\x5f\x65\
-\x6c\x65\x6d\x28\x26\x72\x66\x75\x73\x65\x5f\x73\x74\x61\x74\x65\x73\x2c\x20\
-\x6b\x65\x79\x29\x3b\0\x20\x20\x20\x20\x69\x66\x20\x28\x21\x73\x74\x29\0\x20\
-\x20\x20\x20\x69\x66\x20\x28\x21\x73\x74\x2d\x3e\x74\x73\x5f\x71\x75\x65\x75\
-\x65\x64\x5f\x6e\x73\x29\0\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x2d\x3e\x74\
-\x73\x5f\x71\x75\x65\x75\x65\x64\x5f\x6e\x73\x20\x3d\x20\x62\x70\x66\x5f\x6b\
-\x74\x69\x6d\x65\x5f\x67\x65\x74\x5f\x6e\x73\x28\x29\x3b\x20\x20\x20\x20\x20\
-\x20\x20\x20\x20\x2f\x2a\x20\xeb\x98\x90\xeb\x8a\x94\x20\x62\x70\x66\x5f\x6b\
-\x74\x69\x6d\x65\x5f\x67\x65\x74\x5f\x6e\x73\x28\x29\x3b\x20\x2a\x2f\0\x20\x20\
-\x20\x20\x73\x74\x2d\x3e\x75\x6e\x69\x71\x75\x65\x20\x3d\x20\x75\x6e\x69\x71\
-\x75\x65\x3b\0\x20\x20\x20\x20\x73\x74\x2d\x3e\x6f\x70\x63\x6f\x64\x65\x20\x3d\
-\x20\x6f\x70\x63\x6f\x64\x65\x3b\0\x20\x20\x20\x20\x74\x73\x20\x3d\x20\x62\x70\
-\x66\x5f\x6d\x61\x70\x5f\x6c\x6f\x6f\x6b\x75\x70\x5f\x65\x6c\x65\x6d\x28\x26\
-\x70\x69\x64\x5f\x61\x6c\x6c\x6f\x63\x5f\x6d\x61\x70\x2c\x20\x26\x74\x69\x64\
-\x29\x3b\0\x20\x20\x20\x20\x69\x66\x20\x28\x74\x73\x29\x20\x7b\0\x20\x20\x20\
-\x20\x20\x20\x20\x20\x69\x66\x20\x28\x73\x74\x2d\x3e\x74\x73\x5f\x71\x75\x65\
-\x75\x65\x64\x5f\x6e\x73\x20\x3e\x20\x2a\x74\x73\x29\x20\x7b\0\x20\x20\x20\x20\
-\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x2d\x3e\x61\x6c\x6c\x6f\x63\x5f\x64\
-\x65\x6c\x61\x79\x5f\x6e\x73\x20\x3d\x20\x73\x74\x2d\x3e\x74\x73\x5f\x71\x75\
-\x65\x75\x65\x64\x5f\x6e\x73\x20\x2d\x20\x2a\x74\x73\x3b\0\x20\x20\x20\x20\x20\
-\x20\x20\x20\x62\x70\x66\x5f\x6d\x61\x70\x5f\x64\x65\x6c\x65\x74\x65\x5f\x65\
-\x6c\x65\x6d\x28\x26\x70\x69\x64\x5f\x61\x6c\x6c\x6f\x63\x5f\x6d\x61\x70\x2c\
-\x20\x26\x74\x69\x64\x29\x3b\0\x20\x20\x20\x20\x7d\x20\x65\x6c\x73\x65\x20\x7b\
-\0\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x2d\x3e\x61\x6c\x6c\x6f\x63\x5f\x64\
-\x65\x6c\x61\x79\x5f\x6e\x73\x20\x3d\x20\x30\x3b\0\x7d\0\x75\x70\x5f\x72\x66\
-\x75\x73\x65\x5f\x72\x65\x61\x64\x5f\x72\x65\x71\x75\x65\x73\x74\0\x75\x70\x72\
-\x6f\x62\x65\0\x20\x20\x20\x20\x5f\x5f\x75\x33\x32\x20\x6f\x70\x63\x6f\x64\x65\
-\x20\x3d\x20\x28\x5f\x5f\x75\x33\x32\x29\x50\x54\x5f\x52\x45\x47\x53\x5f\x50\
-\x41\x52\x4d\x31\x28\x63\x74\x78\x29\x3b\0\x20\x20\x20\x20\x5f\x5f\x75\x36\x34\
-\x20\x75\x6e\x69\x71\x75\x65\x20\x3d\x20\x28\x5f\x5f\x75\x36\x34\x29\x50\x54\
-\x5f\x52\x45\x47\x53\x5f\x50\x41\x52\x4d\x32\x28\x63\x74\x78\x29\x3b\0\x20\x20\
-\x20\x20\x69\x6e\x74\x20\x20\x20\x72\x69\x71\x5f\x69\x64\x20\x3d\x20\x28\x69\
-\x6e\x74\x29\x50\x54\x5f\x52\x45\x47\x53\x5f\x50\x41\x52\x4d\x33\x28\x63\x74\
-\x78\x29\x3b\0\x20\x20\x20\x20\x5f\x5f\x75\x33\x32\x20\x74\x69\x64\x20\x20\x20\
-\x20\x3d\x20\x28\x5f\x5f\x75\x33\x32\x29\x62\x70\x66\x5f\x67\x65\x74\x5f\x63\
-\x75\x72\x72\x65\x6e\x74\x5f\x70\x69\x64\x5f\x74\x67\x69\x64\x28\x29\x3b\0\x20\
-\x20\x20\x20\x69\x66\x20\x28\x21\x73\x74\x2d\x3e\x74\x73\x5f\x64\x65\x71\x75\
-\x65\x75\x65\x64\x5f\x6e\x73\x29\0\x20\x20\x20\x20\x20\x20\x20\x20\x73\x74\x2d\
-\x3e\x74\x73\x5f\x64\x65\x71\x75\x65\x75\x65\x64\x5f\x6e\x73\x20\x3d\x20\x62\
-\x70\x66\x5f\x6b\x74\x69\x6d\x65\x5f\x67\x65\x74\x5f\x6e\x73\x28\x29\x3b\0\x20\
-\x20\x20\x20\x73\x74\x2d\x3e\x70\x69\x64\x20\x20\x20\x20\x3d\x20\x74\x69\x64\
-\x3b\0\x75\x70\x5f\x72\x66\x75\x73\x65\x5f\x63\x6f\x70\x79\x5f\x66\x72\x6f\x6d\
-\x5f\x70\x61\x79\x6c\x6f\x61\x64\x5f\x62\x65\x67\x69\x6e\x5f\x65\x6e\x64\0\x30\
-\x3a\x31\x31\0\x20\x20\x20\x20\x5f\x5f\x75\x36\x34\x20\x6c\x61\x74\x65\x6e\x63\
-\x79\x5f\x6e\x73\x20\x20\x3d\x20\x28\x5f\x5f\x75\x36\x34\x29\x50\x54\x5f\x52\
-\x45\x47\x53\x5f\x50\x41\x52\x4d\x34\x28\x63\x74\x78\x29\x3b\0\x20\x20\x20\x20\
-\x5f\x5f\x75\x33\x32\x20\x6f\x70\x63\x6f\x64\x65\x20\x20\x20\x20\x20\x20\x3d\
-\x20\x28\x5f\x5f\x75\x33\x32\x29\x50\x54\x5f\x52\x45\x47\x53\x5f\x50\x41\x52\
-\x4d\x31\x28\x63\x74\x78\x29\x3b\0\x20\x20\x20\x20\x5f\x5f\x75\x36\x34\x20\x75\
-\x6e\x69\x71\x75\x65\x20\x20\x20\x20\x20\x20\x3d\x20\x28\x5f\x5f\x75\x36\x34\
-\x29\x50\x54\x5f\x52\x45\x47\x53\x5f\x50\x41\x52\x4d\x32\x28\x63\x74\x78\x29\
-\x3b\0\x20\x20\x20\x20\x69\x6e\x74\x20\x20\x20\x72\x69\x71\x5f\x69\x64\x20\x20\
-\x20\x20\x20\x20\x3d\x20\x28\x69\x6e\x74\x29\x50\x54\x5f\x52\x45\x47\x53\x5f\
-\x50\x41\x52\x4d\x33\x28\x63\x74\x78\x29\x3b\0\x20\x20\x20\x20\x73\x74\x2d\x3e\
-\x63\x6f\x70\x79\x5f\x66\x72\x6f\x6d\x5f\x6c\x61\x74\x65\x6e\x63\x79\x5f\x6e\
-\x73\x20\x3d\x20\x6c\x61\x74\x65\x6e\x63\x79\x5f\x6e\x73\x3b\0\x75\x70\x5f\x72\
-\x66\x75\x73\x65\x5f\x63\x6f\x70\x79\x5f\x74\x6f\x5f\x70\x61\x79\x6c\x6f\x61\
-\x64\x5f\x62\x65\x67\x69\x6e\x5f\x65\x6e\x64\0\x20\x20\x20\x20\x73\x74\x2d\x3e\
-\x63\x6f\x70\x79\x5f\x74\x6f\x5f\x6c\x61\x74\x65\x6e\x63\x79\x5f\x6e\x73\x20\
-\x3d\x20\x6c\x61\x74\x65\x6e\x63\x79\x5f\x6e\x73\x3b\0\x75\x70\x5f\x72\x66\x75\
-\x73\x65\x5f\x73\x65\x6e\x64\x5f\x72\x65\x73\x75\x6c\x74\0\x20\x20\x20\x20\x73\
-\x74\x2d\x3e\x74\x73\x5f\x64\x61\x65\x6d\x6f\x6e\x5f\x64\x6f\x6e\x65\x5f\x6e\
-\x73\x20\x3d\x20\x62\x70\x66\x5f\x6b\x74\x69\x6d\x65\x5f\x67\x65\x74\x5f\x6e\
-\x73\x28\x29\x3b\0\x6b\x70\x5f\x72\x66\x75\x73\x65\x5f\x72\x65\x71\x75\x65\x73\
-\x74\x5f\x65\x6e\x64\0\x6b\x70\x72\x6f\x62\x65\x2f\x72\x66\x75\x73\x65\x5f\x72\
-\x65\x71\x75\x65\x73\x74\x5f\x65\x6e\x64\0\x20\x20\x20\x20\x73\x74\x72\x75\x63\
-\x74\x20\x72\x66\x75\x73\x65\x5f\x72\x65\x71\x20\x2a\x72\x5f\x72\x65\x71\x20\
-\x3d\x20\x28\x76\x6f\x69\x64\x20\x2a\x29\x50\x54\x5f\x52\x45\x47\x53\x5f\x50\
-\x41\x52\x4d\x31\x28\x63\x74\x78\x29\x3b\0\x20\x20\x20\x20\x5f\x5f\x75\x33\x32\
-\x20\x72\x69\x71\x5f\x69\x64\x20\x3d\x20\x30\x3b\0\x20\x20\x20\x20\x5f\x5f\x75\
-\x36\x34\x20\x75\x6e\x69\x71\x75\x65\x20\x3d\x20\x30\x3b\0\x20\x20\x20\x20\x5f\
-\x5f\x75\x36\x34\x20\x6e\x6f\x77\x20\x3d\x20\x62\x70\x66\x5f\x6b\x74\x69\x6d\
-\x65\x5f\x67\x65\x74\x5f\x6e\x73\x28\x29\x3b\0\x20\x20\x20\x20\x69\x66\x20\x28\
-\x21\x72\x5f\x72\x65\x71\x29\0\x20\x20\x20\x20\x62\x70\x66\x5f\x70\x72\x6f\x62\
-\x65\x5f\x72\x65\x61\x64\x5f\x6b\x65\x72\x6e\x65\x6c\x28\x26\x72\x69\x71\x5f\
-\x69\x64\x2c\x20\x73\x69\x7a\x65\x6f\x66\x28\x72\x69\x71\x5f\x69\x64\x29\x2c\
-\x20\x26\x72\x5f\x72\x65\x71\x2d\x3e\x72\x69\x71\x5f\x69\x64\x29\x3b\0\x20\x20\
-\x20\x20\x62\x70\x66\x5f\x70\x72\x6f\x62\x65\x5f\x72\x65\x61\x64\x5f\x6b\x65\
-\x72\x6e\x65\x6c\x28\x26\x75\x6e\x69\x71\x75\x65\x2c\x20\x73\x69\x7a\x65\x6f\
-\x66\x28\x75\x6e\x69\x71\x75\x65\x29\x2c\x20\x26\x72\x5f\x72\x65\x71\x2d\x3e\
-\x69\x6e\x2e\x75\x6e\x69\x71\x75\x65\x29\x3b\0\x20\x20\x20\x20\x6b\x65\x79\x2e\
-\x72\x69\x71\x5f\x69\x64\x20\x3d\x20\x28\x69\x6e\x74\x29\x72\x69\x71\x5f\x69\
-\x64\x3b\0\x20\x20\x20\x20\x73\x74\x20\x3d\x20\x62\x70\x66\x5f\x6d\x61\x70\x5f\
-\x6c\x6f\x6f\x6b\x75\x70\x5f\x65\x6c\x65\x6d\x28\x26\x72\x66\x75\x73\x65\x5f\
-\x73\x74\x61\x74\x65\x73\x2c\x20\x26\x6b\x65\x79\x29\x3b\0\x20\x20\x20\x20\x73\
-\x74\x2d\x3e\x74\x73\x5f\x65\x6e\x64\x5f\x6e\x73\x20\x3d\x20\x6e\x6f\x77\x3b\0\
-\x20\x20\x20\x20\x69\x66\x20\x28\x73\x74\x2d\x3e\x74\x73\x5f\x71\x75\x65\x75\
-\x65\x64\x5f\x6e\x73\x20\x26\x26\x20\x73\x74\x2d\x3e\x74\x73\x5f\x64\x65\x71\
-\x75\x65\x75\x65\x64\x5f\x6e\x73\x29\0\x20\x20\x20\x20\x20\x20\x20\x20\x71\x75\
-\x65\x75\x65\x5f\x64\x65\x6c\x61\x79\x20\x3d\x20\x73\x74\x2d\x3e\x74\x73\x5f\
-\x64\x65\x71\x75\x65\x75\x65\x64\x5f\x6e\x73\x20\x2d\x20\x73\x74\x2d\x3e\x74\
-\x73\x5f\x71\x75\x65\x75\x65\x64\x5f\x6e\x73\x3b\0\x20\x20\x20\x20\x69\x66\x20\
-\x28\x73\x74\x2d\x3e\x74\x73\x5f\x64\x65\x71\x75\x65\x75\x65\x64\x5f\x6e\x73\
-\x20\x26\x26\x20\x73\x74\x2d\x3e\x74\x73\x5f\x64\x61\x65\x6d\x6f\x6e\x5f\x64\
-\x6f\x6e\x65\x5f\x6e\x73\x29\0\x20\x20\x20\x20\x20\x20\x20\x20\x64\x61\x65\x6d\
-\x6f\x6e\x5f\x64\x65\x6c\x61\x79\x20\x3d\x20\x73\x74\x2d\x3e\x74\x73\x5f\x64\
-\x61\x65\x6d\x6f\x6e\x5f\x64\x6f\x6e\x65\x5f\x6e\x73\x20\x2d\x20\x73\x74\x2d\
-\x3e\x74\x73\x5f\x64\x65\x71\x75\x65\x75\x65\x64\x5f\x6e\x73\x3b\0\x20\x20\x20\
-\x20\x65\x76\x20\x3d\x20\x62\x70\x66\x5f\x72\x69\x6e\x67\x62\x75\x66\x5f\x72\
-\x65\x73\x65\x72\x76\x65\x28\x26\x72\x66\x75\x73\x65\x5f\x65\x76\x65\x6e\x74\
-\x73\x2c\x20\x73\x69\x7a\x65\x6f\x66\x28\x2a\x65\x76\x29\x2c\x20\x30\x29\x3b\0\
-\x20\x20\x20\x20\x69\x66\x20\x28\x21\x65\x76\x29\0\x20\x20\x20\x20\x65\x76\x2d\
-\x3e\x74\x73\x5f\x6e\x73\x20\x20\x3d\x20\x73\x74\x2d\x3e\x74\x73\x5f\x71\x75\
-\x65\x75\x65\x64\x5f\x6e\x73\x3b\0\x20\x20\x20\x20\x65\x76\x2d\x3e\x72\x69\x71\
-\x5f\x69\x64\x20\x3d\x20\x6b\x65\x79\x2e\x72\x69\x71\x5f\x69\x64\x3b\0\x20\x20\
-\x20\x20\x65\x76\x2d\x3e\x72\x65\x71\x5f\x69\x6e\x64\x65\x78\x20\x3d\x20\x30\
-\x3b\x20\x20\x20\x20\x20\x20\x2f\x2f\x20\xec\x9d\xb4\xec\xa0\x9c\x20\xec\x9d\
-\x98\xeb\xaf\xb8\x20\xec\x97\x86\xec\x9d\x8c\x2c\x20\xea\xb7\xb8\xeb\x83\xa5\
-\x20\x30\0\x20\x20\x20\x20\x65\x76\x2d\x3e\x75\x6e\x69\x71\x75\x65\x20\x3d\x20\
-\x73\x74\x2d\x3e\x75\x6e\x69\x71\x75\x65\x3b\0\x20\x20\x20\x20\x65\x76\x2d\x3e\
-\x6f\x70\x63\x6f\x64\x65\x20\x3d\x20\x73\x74\x2d\x3e\x6f\x70\x63\x6f\x64\x65\
-\x3b\0\x20\x20\x20\x20\x65\x76\x2d\x3e\x70\x69\x64\x20\x20\x20\x20\x3d\x20\x73\
-\x74\x2d\x3e\x70\x69\x64\x3b\0\x20\x20\x20\x20\x62\x70\x66\x5f\x67\x65\x74\x5f\
-\x63\x75\x72\x72\x65\x6e\x74\x5f\x63\x6f\x6d\x6d\x28\x65\x76\x2d\x3e\x63\x6f\
-\x6d\x6d\x2c\x20\x73\x69\x7a\x65\x6f\x66\x28\x65\x76\x2d\x3e\x63\x6f\x6d\x6d\
-\x29\x29\x3b\0\x20\x20\x20\x20\x69\x66\x20\x28\x73\x74\x2d\x3e\x74\x73\x5f\x64\
-\x61\x65\x6d\x6f\x6e\x5f\x64\x6f\x6e\x65\x5f\x6e\x73\x20\x26\x26\x20\x73\x74\
-\x2d\x3e\x74\x73\x5f\x65\x6e\x64\x5f\x6e\x73\x29\0\x20\x20\x20\x20\x65\x76\x2d\
-\x3e\x61\x6c\x6c\x6f\x63\x5f\x64\x65\x6c\x61\x79\x5f\x6e\x73\x20\x20\x20\x20\
-\x20\x20\x3d\x20\x73\x74\x2d\x3e\x61\x6c\x6c\x6f\x63\x5f\x64\x65\x6c\x61\x79\
-\x5f\x6e\x73\x3b\0\x20\x20\x20\x20\x65\x76\x2d\x3e\x71\x75\x65\x75\x65\x5f\x64\
-\x65\x6c\x61\x79\x5f\x6e\x73\x20\x20\x20\x20\x20\x20\x3d\x20\x71\x75\x65\x75\
-\x65\x5f\x64\x65\x6c\x61\x79\x3b\0\x20\x20\x20\x20\x65\x76\x2d\x3e\x64\x61\x65\
-\x6d\x6f\x6e\x5f\x64\x65\x6c\x61\x79\x5f\x6e\x73\x20\x20\x20\x20\x20\x3d\x20\
-\x64\x61\x65\x6d\x6f\x6e\x5f\x64\x65\x6c\x61\x79\x3b\0\x20\x20\x20\x20\x65\x76\
-\x2d\x3e\x72\x65\x73\x70\x6f\x6e\x73\x65\x5f\x64\x65\x6c\x61\x79\x5f\x6e\x73\
-\x20\x20\x20\x3d\x20\x72\x65\x73\x70\x5f\x64\x65\x6c\x61\x79\x3b\0\x20\x20\x20\
-\x20\x65\x76\x2d\x3e\x63\x6f\x70\x79\x5f\x66\x72\x6f\x6d\x5f\x6c\x61\x74\x65\
-\x6e\x63\x79\x5f\x6e\x73\x20\x3d\x20\x73\x74\x2d\x3e\x63\x6f\x70\x79\x5f\x66\
-\x72\x6f\x6d\x5f\x6c\x61\x74\x65\x6e\x63\x79\x5f\x6e\x73\x3b\0\x20\x20\x20\x20\
-\x65\x76\x2d\x3e\x63\x6f\x70\x79\x5f\x74\x6f\x5f\x6c\x61\x74\x65\x6e\x63\x79\
-\x5f\x6e\x73\x20\x20\x20\x3d\x20\x73\x74\x2d\x3e\x63\x6f\x70\x79\x5f\x74\x6f\
-\x5f\x6c\x61\x74\x65\x6e\x63\x79\x5f\x6e\x73\x3b\0\x20\x20\x20\x20\x62\x70\x66\
-\x5f\x72\x69\x6e\x67\x62\x75\x66\x5f\x73\x75\x62\x6d\x69\x74\x28\x65\x76\x2c\
-\x20\x30\x29\x3b\0\x20\x20\x20\x20\x62\x70\x66\x5f\x6d\x61\x70\x5f\x64\x65\x6c\
-\x65\x74\x65\x5f\x65\x6c\x65\x6d\x28\x26\x72\x66\x75\x73\x65\x5f\x73\x74\x61\
-\x74\x65\x73\x2c\x20\x26\x6b\x65\x79\x29\x3b\0\x63\x68\x61\x72\0\x4c\x49\x43\
-\x45\x4e\x53\x45\0\x2e\x6d\x61\x70\x73\0\x6c\x69\x63\x65\x6e\x73\x65\0\0\0\x9f\
-\xeb\x01\0\x20\0\0\0\0\0\0\0\x6c\0\0\0\x6c\0\0\0\x6c\x0a\0\0\xd8\x0a\0\0\x3c\
-\x01\0\0\x08\0\0\0\xd2\x01\0\0\x01\0\0\0\0\0\0\0\x27\0\0\0\xd5\x02\0\0\x01\0\0\
-\0\0\0\0\0\x29\0\0\0\x06\x03\0\0\x01\0\0\0\0\0\0\0\x2b\0\0\0\xba\x06\0\0\x04\0\
-\0\0\0\0\0\0\x2d\0\0\0\xa8\x01\0\0\x2f\0\0\0\0\x03\0\0\x31\0\0\0\x58\x04\0\0\
-\x33\0\0\0\xa8\x09\0\0\x01\0\0\0\0\0\0\0\x35\0\0\0\x10\0\0\0\xd2\x01\0\0\x06\0\
-\0\0\0\0\0\0\xe7\x01\0\0\x1f\x02\0\0\x18\x3c\x01\0\x08\0\0\0\xe7\x01\0\0\x1f\
-\x02\0\0\x0b\x3c\x01\0\x10\0\0\0\xe7\x01\0\0\x52\x02\0\0\x10\x40\x01\0\x18\0\0\
-\0\xe7\x01\0\0\x52\x02\0\0\x0b\x40\x01\0\x40\0\0\0\xe7\x01\0\0\x75\x02\0\0\x05\
-\x44\x01\0\x60\0\0\0\xe7\x01\0\0\xb2\x02\0\0\x05\x48\x01\0\xd5\x02\0\0\x06\0\0\
-\0\0\0\0\0\xe7\x01\0\0\x1f\x02\0\0\x18\x60\x01\0\x08\0\0\0\xe7\x01\0\0\x1f\x02\
-\0\0\x0b\x60\x01\0\x10\0\0\0\xe7\x01\0\0\x52\x02\0\0\x10\x64\x01\0\x18\0\0\0\
-\xe7\x01\0\0\x52\x02\0\0\x0b\x64\x01\0\x40\0\0\0\xe7\x01\0\0\x75\x02\0\0\x05\
-\x68\x01\0\x60\0\0\0\xe7\x01\0\0\xb2\x02\0\0\x05\x6c\x01\0\x06\x03\0\0\x1f\0\0\
-\0\0\0\0\0\xe7\x01\0\0\x27\x03\0\0\x1f\xa0\x01\0\x08\0\0\0\xe7\x01\0\0\x5e\x03\
-\0\0\x1f\xa4\x01\0\x10\0\0\0\xe7\x01\0\0\x95\x03\0\0\x1d\xa8\x01\0\x20\0\0\0\
-\xe7\x01\0\0\xc5\x03\0\0\x1a\xb0\x01\0\x28\0\0\0\xe7\x01\0\0\x1f\x02\0\0\x18\
-\xbc\x01\0\x30\0\0\0\xe7\x01\0\0\xe8\x03\0\0\x10\xc4\x01\0\x38\0\0\0\xe7\x01\0\
-\0\x1f\x02\0\0\x0b\xbc\x01\0\x40\0\0\0\xe7\x01\0\0\x01\x04\0\0\x10\xc8\x01\0\
-\x58\0\0\0\xe7\x01\0\0\x1a\x04\0\0\x0a\xec\0\0\x78\0\0\0\xe7\x01\0\0\x4c\x04\0\
-\0\x09\xf0\0\0\x80\0\0\0\xe7\x01\0\0\x58\x04\0\0\x1c\xfc\0\0\xf0\0\0\0\xe7\x01\
-\0\0\x7e\x04\0\0\x05\0\x01\0\x18\x01\0\0\xe7\x01\0\0\xbb\x04\0\0\x0c\x04\x01\0\
-\x40\x01\0\0\xe7\x01\0\0\xef\x04\0\0\x09\xd4\x01\0\x48\x01\0\0\xe7\x01\0\0\xfc\
-\x04\0\0\x0e\xe0\x01\0\x50\x01\0\0\xe7\x01\0\0\xfc\x04\0\0\x09\xe0\x01\0\x58\
-\x01\0\0\xe7\x01\0\0\x17\x05\0\0\x1c\xe4\x01\0\x60\x01\0\0\xe7\x01\0\0\x17\x05\
-\0\0\x1a\xe4\x01\0\x68\x01\0\0\xe7\x01\0\0\x6f\x05\0\0\x10\xf0\x01\0\x70\x01\0\
-\0\xe7\x01\0\0\x88\x05\0\0\x10\xec\x01\0\x88\x01\0\0\xe7\x01\0\0\xa1\x05\0\0\
-\x0a\xf4\x01\0\xa0\x01\0\0\xe7\x01\0\0\xd5\x05\0\0\x09\xf8\x01\0\xa8\x01\0\0\
-\xe7\x01\0\0\xe3\x05\0\0\x20\xfc\x01\0\xb0\x01\0\0\xe7\x01\0\0\xe3\x05\0\0\x11\
-\xfc\x01\0\xb8\x01\0\0\xe7\x01\0\0\xe3\x05\0\0\x1e\xfc\x01\0\xc0\x01\0\0\xe7\
-\x01\0\0\x09\x06\0\0\x33\0\x02\0\xc8\x01\0\0\xe7\x01\0\0\x09\x06\0\0\x20\0\x02\
-\0\xe0\x01\0\0\xe7\x01\0\0\x42\x06\0\0\x09\x08\x02\0\xf8\x01\0\0\xe7\x01\0\0\
-\x75\x06\0\0\x05\x0c\x02\0\x08\x02\0\0\xe7\x01\0\0\x82\x06\0\0\x1c\x10\x02\0\
-\x10\x02\0\0\xe7\x01\0\0\xa2\x06\0\0\x01\x20\x02\0\xba\x06\0\0\x48\0\0\0\0\0\0\
-\0\xe7\x01\0\0\xc1\x06\0\0\x1b\x68\x02\0\x08\0\0\0\xe7\x01\0\0\xef\x06\0\0\x1b\
-\x6c\x02\0\x18\0\0\0\xe7\x01\0\0\x1d\x07\0\0\x19\x70\x02\0\x20\0\0\0\xe7\x01\0\
-\0\x49\x07\0\0\x1b\x74\x02\0\x38\0\0\0\xe7\x01\0\0\xc5\x03\0\0\x1a\x84\x02\0\
-\x40\0\0\0\xe7\x01\0\0\xe8\x03\0\0\x10\x90\x02\0\x48\0\0\0\xe7\x01\0\0\x01\x04\
-\0\0\x10\x94\x02\0\x60\0\0\0\xe7\x01\0\0\x1a\x04\0\0\x0a\xec\0\0\x78\0\0\0\xe7\
-\x01\0\0\x4c\x04\0\0\x09\xf0\0\0\x80\0\0\0\xe7\x01\0\0\x58\x04\0\0\x1c\xfc\0\0\
-\xf0\0\0\0\xe7\x01\0\0\x7e\x04\0\0\x05\0\x01\0\x18\x01\0\0\xe7\x01\0\0\xbb\x04\
-\0\0\x0c\x04\x01\0\x38\x01\0\0\xe7\x01\0\0\xef\x04\0\0\x09\xa0\x02\0\x40\x01\0\
-\0\xe7\x01\0\0\x7f\x07\0\0\x0e\xac\x02\0\x48\x01\0\0\xe7\x01\0\0\x7f\x07\0\0\
-\x09\xac\x02\0\x58\x01\0\0\xe7\x01\0\0\x9c\x07\0\0\x1e\xb0\x02\0\x70\x01\0\0\
-\xe7\x01\0\0\x9c\x07\0\0\x1c\xb0\x02\0\x78\x01\0\0\xe7\x01\0\0\xcd\x07\0\0\x10\
-\xc0\x02\0\x80\x01\0\0\xe7\x01\0\0\x6f\x05\0\0\x10\xbc\x02\0\x88\x01\0\0\xe7\
-\x01\0\0\x88\x05\0\0\x10\xb8\x02\0\x98\x01\0\0\xe7\x01\0\0\xa2\x06\0\0\x01\xcc\
-\x02\0\xa8\x01\0\0\xe7\x01\0\0\x0d\x08\0\0\x20\x38\x03\0\xb0\x01\0\0\xe7\x01\0\
-\0\x40\x08\0\0\x20\x2c\x03\0\xb8\x01\0\0\xe7\x01\0\0\x73\x08\0\0\x20\x30\x03\0\
-\xc0\x01\0\0\xe7\x01\0\0\xa6\x08\0\0\x1e\x34\x03\0\xd0\x01\0\0\xe7\x01\0\0\xc5\
-\x03\0\0\x1a\x40\x03\0\xd8\x01\0\0\xe7\x01\0\0\xe8\x03\0\0\x10\x4c\x03\0\xe0\
-\x01\0\0\xe7\x01\0\0\x01\x04\0\0\x10\x50\x03\0\xf8\x01\0\0\xe7\x01\0\0\x1a\x04\
-\0\0\x0a\xec\0\0\x10\x02\0\0\xe7\x01\0\0\x4c\x04\0\0\x09\xf0\0\0\x18\x02\0\0\
-\xe7\x01\0\0\x58\x04\0\0\x1c\xfc\0\0\x88\x02\0\0\xe7\x01\0\0\x7e\x04\0\0\x05\0\
-\x01\0\xb0\x02\0\0\xe7\x01\0\0\xbb\x04\0\0\x0c\x04\x01\0\xd0\x02\0\0\xe7\x01\0\
-\0\xef\x04\0\0\x09\x5c\x03\0\xd8\x02\0\0\xe7\x01\0\0\xd7\x08\0\0\x1e\x68\x03\0\
-\xe0\x02\0\0\xe7\x01\0\0\x6f\x05\0\0\x10\x70\x03\0\xe8\x02\0\0\xe7\x01\0\0\x88\
-\x05\0\0\x10\x6c\x03\0\xf0\x02\0\0\xe7\x01\0\0\xa2\x06\0\0\x01\x7c\x03\0\0\x03\
-\0\0\xe7\x01\0\0\x0d\x08\0\0\x20\xa0\x03\0\x08\x03\0\0\xe7\x01\0\0\x40\x08\0\0\
-\x20\x94\x03\0\x10\x03\0\0\xe7\x01\0\0\x73\x08\0\0\x20\x98\x03\0\x18\x03\0\0\
-\xe7\x01\0\0\xa6\x08\0\0\x1e\x9c\x03\0\x28\x03\0\0\xe7\x01\0\0\xc5\x03\0\0\x1a\
-\xa8\x03\0\x30\x03\0\0\xe7\x01\0\0\xe8\x03\0\0\x10\xb4\x03\0\x38\x03\0\0\xe7\
-\x01\0\0\x01\x04\0\0\x10\xb8\x03\0\x50\x03\0\0\xe7\x01\0\0\x1a\x04\0\0\x0a\xec\
-\0\0\x68\x03\0\0\xe7\x01\0\0\x4c\x04\0\0\x09\xf0\0\0\x70\x03\0\0\xe7\x01\0\0\
-\x58\x04\0\0\x1c\xfc\0\0\xe0\x03\0\0\xe7\x01\0\0\x7e\x04\0\0\x05\0\x01\0\x08\
-\x04\0\0\xe7\x01\0\0\xbb\x04\0\0\x0c\x04\x01\0\x28\x04\0\0\xe7\x01\0\0\xef\x04\
-\0\0\x09\xc4\x03\0\x30\x04\0\0\xe7\x01\0\0\x25\x09\0\0\x1c\xd0\x03\0\x38\x04\0\
-\0\xe7\x01\0\0\x6f\x05\0\0\x10\xd8\x03\0\x40\x04\0\0\xe7\x01\0\0\x88\x05\0\0\
-\x10\xd4\x03\0\x48\x04\0\0\xe7\x01\0\0\xa2\x06\0\0\x01\xe4\x03\0\x58\x04\0\0\
-\xe7\x01\0\0\xc1\x06\0\0\x1b\x2c\x04\0\x60\x04\0\0\xe7\x01\0\0\xef\x06\0\0\x1b\
-\x30\x04\0\x68\x04\0\0\xe7\x01\0\0\x1d\x07\0\0\x19\x34\x04\0\x78\x04\0\0\xe7\
-\x01\0\0\xc5\x03\0\0\x1a\x40\x04\0\x80\x04\0\0\xe7\x01\0\0\xe8\x03\0\0\x10\x4c\
-\x04\0\x88\x04\0\0\xe7\x01\0\0\x01\x04\0\0\x10\x50\x04\0\xa0\x04\0\0\xe7\x01\0\
-\0\x1a\x04\0\0\x0a\xec\0\0\xc0\x04\0\0\xe7\x01\0\0\x4c\x04\0\0\x09\xf0\0\0\xc8\
-\x04\0\0\xe7\x01\0\0\x58\x04\0\0\x1c\xfc\0\0\x38\x05\0\0\xe7\x01\0\0\x7e\x04\0\
-\0\x05\0\x01\0\x60\x05\0\0\xe7\x01\0\0\xbb\x04\0\0\x0c\x04\x01\0\x88\x05\0\0\
-\xe7\x01\0\0\xef\x04\0\0\x09\x5c\x04\0\x90\x05\0\0\xe7\x01\0\0\x63\x09\0\0\x1d\
-\x68\x04\0\x98\x05\0\0\xe7\x01\0\0\x63\x09\0\0\x1b\x68\x04\0\xa0\x05\0\0\xe7\
-\x01\0\0\x88\x05\0\0\x10\x6c\x04\0\xa8\x05\0\0\xe7\x01\0\0\x6f\x05\0\0\x10\x70\
-\x04\0\xb0\x05\0\0\xe7\x01\0\0\xa2\x06\0\0\x01\x7c\x04\0\xa8\x09\0\0\x31\0\0\0\
-\0\0\0\0\xe7\x01\0\0\xc1\x09\0\0\x27\xb0\x04\0\x10\0\0\0\xe7\x01\0\0\xc5\x03\0\
-\0\x1a\xb4\x04\0\x20\0\0\0\xe7\x01\0\0\xfb\x09\0\0\x0b\xc0\x04\0\x28\0\0\0\xe7\
-\x01\0\0\x11\x0a\0\0\x0b\xc4\x04\0\x30\0\0\0\xe7\x01\0\0\x27\x0a\0\0\x11\xc8\
-\x04\0\x40\0\0\0\xe7\x01\0\0\x4b\x0a\0\0\x09\xdc\x04\0\x48\0\0\0\xe7\x01\0\0\
-\x5b\x0a\0\0\x3c\xe8\x04\0\x68\0\0\0\xe7\x01\0\0\x5b\x0a\0\0\x05\xe8\x04\0\x88\
-\0\0\0\xe7\x01\0\0\x9f\x0a\0\0\x05\xec\x04\0\xa0\0\0\0\xe7\x01\0\0\xe6\x0a\0\0\
-\x17\xf4\x04\0\xa8\0\0\0\xe7\x01\0\0\xe6\x0a\0\0\x10\xf4\x04\0\xb0\0\0\0\xe7\
-\x01\0\0\x01\x04\0\0\x12\xf8\x04\0\xb8\0\0\0\xe7\x01\0\0\x01\x04\0\0\x10\xf8\
-\x04\0\xd0\0\0\0\xe7\x01\0\0\x04\x0b\0\0\x0a\0\x05\0\xf0\0\0\0\xe7\x01\0\0\xef\
-\x04\0\0\x09\x04\x05\0\xf8\0\0\0\xe7\x01\0\0\x37\x0b\0\0\x13\x0c\x05\0\x08\x01\
-\0\0\xe7\x01\0\0\x50\x0b\0\0\x0d\x10\x05\0\x10\x01\0\0\xe7\x01\0\0\x50\x0b\0\0\
-\x1a\x10\x05\0\x48\x01\0\0\xe7\x01\0\0\x80\x0b\0\0\x2a\x14\x05\0\x68\x01\0\0\
-\xe7\x01\0\0\xbd\x0b\0\0\x1c\x1c\x05\0\xb8\x01\0\0\xe7\x01\0\0\xf2\x0b\0\0\x2e\
-\x20\x05\0\xd8\x01\0\0\xe7\x01\0\0\x35\x0c\0\0\x0a\x34\x05\0\x08\x02\0\0\xe7\
-\x01\0\0\x72\x0c\0\0\x09\x38\x05\0\x10\x02\0\0\xe7\x01\0\0\x7f\x0c\0\0\x16\x44\
-\x05\0\x18\x02\0\0\xe7\x01\0\0\x7f\x0c\0\0\x10\x44\x05\0\x20\x02\0\0\xe7\x01\0\
-\0\xa2\x0c\0\0\x16\x48\x05\0\x30\x02\0\0\xe7\x01\0\0\xbf\x0c\0\0\x13\x4c\x05\0\
-\x38\x02\0\0\xe7\x01\0\0\xa2\x0c\0\0\x10\x48\x05\0\x40\x02\0\0\xe7\x01\0\0\xfd\
-\x0c\0\0\x16\x50\x05\0\x48\x02\0\0\xe7\x01\0\0\xfd\x0c\0\0\x10\x50\x05\0\x50\
-\x02\0\0\xe7\x01\0\0\x1a\x0d\0\0\x16\x54\x05\0\x58\x02\0\0\xe7\x01\0\0\x1a\x0d\
-\0\0\x10\x54\x05\0\x60\x02\0\0\xe7\x01\0\0\x37\x0d\0\0\x16\x58\x05\0\x68\x02\0\
-\0\xe7\x01\0\0\x37\x0d\0\0\x10\x58\x05\0\x70\x02\0\0\xe7\x01\0\0\x51\x0d\0\0\
-\x1e\x60\x05\0\x80\x02\0\0\xe7\x01\0\0\x51\x0d\0\0\x05\x60\x05\0\xa0\x02\0\0\
-\xe7\x01\0\0\x87\x0d\0\0\x1f\x28\x05\0\xd0\x02\0\0\xe7\x01\0\0\xb7\x0d\0\0\x23\
-\x64\x05\0\xd8\x02\0\0\xe7\x01\0\0\xb7\x0d\0\0\x1d\x64\x05\0\xe0\x02\0\0\xe7\
-\x01\0\0\xe9\x0d\0\0\x1d\x68\x05\0\xf0\x02\0\0\xe7\x01\0\0\x14\x0e\0\0\x1d\x6c\
-\x05\0\xf8\x02\0\0\xe7\x01\0\0\x40\x0e\0\0\x1d\x70\x05\0\0\x03\0\0\xe7\x01\0\0\
-\x6a\x0e\0\0\x24\x74\x05\0\x08\x03\0\0\xe7\x01\0\0\x6a\x0e\0\0\x1e\x74\x05\0\
-\x10\x03\0\0\xe7\x01\0\0\xa3\x0e\0\0\x24\x78\x05\0\x18\x03\0\0\xe7\x01\0\0\xa3\
-\x0e\0\0\x1e\x78\x05\0\x20\x03\0\0\xe7\x01\0\0\xda\x0e\0\0\x05\x80\x05\0\x48\
-\x03\0\0\xe7\x01\0\0\xf9\x0e\0\0\x05\x8c\x05\0\x60\x03\0\0\xe7\x01\0\0\xa2\x06\
-\0\0\x01\x94\x05\0\x10\0\0\0\x06\x03\0\0\x03\0\0\0\0\0\0\0\x24\0\0\0\x22\x03\0\
-\0\0\0\0\0\x08\0\0\0\x24\0\0\0\x59\x03\0\0\0\0\0\0\x10\0\0\0\x24\0\0\0\x90\x03\
-\0\0\0\0\0\0\xba\x06\0\0\x0e\0\0\0\0\0\0\0\x24\0\0\0\x22\x03\0\0\0\0\0\0\x10\0\
-\0\0\x24\0\0\0\x59\x03\0\0\0\0\0\0\x18\0\0\0\x24\0\0\0\x90\x03\0\0\0\0\0\0\xa8\
-\x01\0\0\x24\0\0\0\x08\x08\0\0\0\0\0\0\xb0\x01\0\0\x24\0\0\0\x22\x03\0\0\0\0\0\
-\0\xb8\x01\0\0\x24\0\0\0\x59\x03\0\0\0\0\0\0\xc0\x01\0\0\x24\0\0\0\x90\x03\0\0\
-\0\0\0\0\0\x03\0\0\x24\0\0\0\x08\x08\0\0\0\0\0\0\x08\x03\0\0\x24\0\0\0\x22\x03\
-\0\0\0\0\0\0\x10\x03\0\0\x24\0\0\0\x59\x03\0\0\0\0\0\0\x18\x03\0\0\x24\0\0\0\
-\x90\x03\0\0\0\0\0\0\x58\x04\0\0\x24\0\0\0\x22\x03\0\0\0\0\0\0\x60\x04\0\0\x24\
-\0\0\0\x59\x03\0\0\0\0\0\0\x68\x04\0\0\x24\0\0\0\x90\x03\0\0\0\0\0\0\xa8\x09\0\
-\0\x01\0\0\0\0\0\0\0\x24\0\0\0\x22\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\x03\0\x05\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\x07\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x03\0\x09\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\x03\0\x0b\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xdb\0\0\0\x12\0\x03\0\0\0\0\0\0\
-\0\0\0\x70\0\0\0\0\0\0\0\x05\x01\0\0\x11\0\x0e\0\0\0\0\0\0\0\0\0\x20\0\0\0\0\0\
-\0\0\xa9\0\0\0\x12\0\x05\0\0\0\0\0\0\0\0\0\x70\0\0\0\0\0\0\0\x14\0\0\0\x12\0\
-\x07\0\0\0\0\0\0\0\0\0\x20\x02\0\0\0\0\0\0\x9c\0\0\0\x11\0\x0e\0\x20\0\0\0\0\0\
-\0\0\x20\0\0\0\0\0\0\0\x4c\0\0\0\x12\0\x09\0\0\0\0\0\0\0\0\0\xa8\x01\0\0\0\0\0\
-\0\x89\x01\0\0\x12\0\x09\0\xa8\x01\0\0\0\0\0\0\x58\x01\0\0\0\0\0\0\x66\x01\0\0\
-\x12\0\x09\0\0\x03\0\0\0\0\0\0\x58\x01\0\0\0\0\0\0\x62\0\0\0\x12\0\x09\0\x58\
-\x04\0\0\0\0\0\0\x68\x01\0\0\0\0\0\0\x34\x01\0\0\x12\0\x0b\0\0\0\0\0\0\0\0\0\
-\x70\x03\0\0\0\0\0\0\x89\0\0\0\x11\0\x0e\0\x40\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\
-\xc7\x01\0\0\x11\0\x0d\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\0\0\0\x77\0\0\0\x11\0\x0e\
-\0\x50\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\x40\0\0\0\0\0\0\0\x01\0\0\0\x07\0\0\0\
-\x40\0\0\0\0\0\0\0\x01\0\0\0\x07\0\0\0\x58\0\0\0\0\0\0\0\x01\0\0\0\x0a\0\0\0\
-\xf0\0\0\0\0\0\0\0\x01\0\0\0\x0a\0\0\0\x18\x01\0\0\0\0\0\0\x01\0\0\0\x0a\0\0\0\
-\x88\x01\0\0\0\0\0\0\x01\0\0\0\x07\0\0\0\xe0\x01\0\0\0\0\0\0\x01\0\0\0\x07\0\0\
-\0\x60\0\0\0\0\0\0\0\x01\0\0\0\x0a\0\0\0\xf0\0\0\0\0\0\0\0\x01\0\0\0\x0a\0\0\0\
-\x18\x01\0\0\0\0\0\0\x01\0\0\0\x0a\0\0\0\xf8\x01\0\0\0\0\0\0\x01\0\0\0\x0a\0\0\
-\0\x88\x02\0\0\0\0\0\0\x01\0\0\0\x0a\0\0\0\xb0\x02\0\0\0\0\0\0\x01\0\0\0\x0a\0\
-\0\0\x50\x03\0\0\0\0\0\0\x01\0\0\0\x0a\0\0\0\xe0\x03\0\0\0\0\0\0\x01\0\0\0\x0a\
-\0\0\0\x08\x04\0\0\0\0\0\0\x01\0\0\0\x0a\0\0\0\xa0\x04\0\0\0\0\0\0\x01\0\0\0\
-\x0a\0\0\0\x38\x05\0\0\0\0\0\0\x01\0\0\0\x0a\0\0\0\x60\x05\0\0\0\0\0\0\x01\0\0\
-\0\x0a\0\0\0\xd0\0\0\0\0\0\0\0\x01\0\0\0\x0a\0\0\0\xd8\x01\0\0\0\0\0\0\x01\0\0\
-\0\x10\0\0\0\x48\x03\0\0\0\0\0\0\x01\0\0\0\x0a\0\0\0\xa4\x05\0\0\0\0\0\0\x04\0\
-\0\0\x07\0\0\0\xb0\x05\0\0\0\0\0\0\x04\0\0\0\x0a\0\0\0\xbc\x05\0\0\0\0\0\0\x04\
-\0\0\0\x10\0\0\0\xc8\x05\0\0\0\0\0\0\x04\0\0\0\x12\0\0\0\xe0\x05\0\0\0\0\0\0\
-\x04\0\0\0\x11\0\0\0\x2c\0\0\0\0\0\0\0\x04\0\0\0\x01\0\0\0\x3c\0\0\0\0\0\0\0\
-\x04\0\0\0\x02\0\0\0\x4c\0\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\x5c\0\0\0\0\0\0\0\
-\x04\0\0\0\x04\0\0\0\x64\0\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x6c\0\0\0\0\0\0\0\
-\x04\0\0\0\x04\0\0\0\x74\0\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x84\0\0\0\0\0\0\0\
-\x04\0\0\0\x05\0\0\0\x98\0\0\0\0\0\0\0\x04\0\0\0\x01\0\0\0\xa8\0\0\0\0\0\0\0\
-\x04\0\0\0\x01\0\0\0\xb8\0\0\0\0\0\0\0\x04\0\0\0\x01\0\0\0\xc8\0\0\0\0\0\0\0\
-\x04\0\0\0\x01\0\0\0\xd8\0\0\0\0\0\0\0\x04\0\0\0\x01\0\0\0\xe8\0\0\0\0\0\0\0\
-\x04\0\0\0\x01\0\0\0\0\x01\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x10\x01\0\0\0\0\0\0\
-\x04\0\0\0\x02\0\0\0\x20\x01\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x30\x01\0\0\0\0\0\
-\0\x04\0\0\0\x02\0\0\0\x40\x01\0\0\0\0\0\0\x04\0\0\0\x02\0\0\0\x50\x01\0\0\0\0\
-\0\0\x04\0\0\0\x02\0\0\0\x68\x01\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\x78\x01\0\0\0\
-\0\0\0\x04\0\0\0\x03\0\0\0\x88\x01\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\x98\x01\0\0\
-\0\0\0\0\x04\0\0\0\x03\0\0\0\xa8\x01\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\xb8\x01\0\
-\0\0\0\0\0\x04\0\0\0\x03\0\0\0\xc8\x01\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\xd8\x01\
-\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\xe8\x01\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\xf8\
-\x01\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\x08\x02\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\
-\x18\x02\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\x28\x02\0\0\0\0\0\0\x04\0\0\0\x03\0\0\
-\0\x38\x02\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\x48\x02\0\0\0\0\0\0\x04\0\0\0\x03\0\
-\0\0\x58\x02\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\x68\x02\0\0\0\0\0\0\x04\0\0\0\x03\
-\0\0\0\x78\x02\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\x88\x02\0\0\0\0\0\0\x04\0\0\0\
-\x03\0\0\0\x98\x02\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\xa8\x02\0\0\0\0\0\0\x04\0\0\
-\0\x03\0\0\0\xb8\x02\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\xc8\x02\0\0\0\0\0\0\x04\0\
-\0\0\x03\0\0\0\xd8\x02\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\xe8\x02\0\0\0\0\0\0\x04\
-\0\0\0\x03\0\0\0\xf8\x02\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\x08\x03\0\0\0\0\0\0\
-\x04\0\0\0\x03\0\0\0\x18\x03\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\x28\x03\0\0\0\0\0\
-\0\x04\0\0\0\x03\0\0\0\x38\x03\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\x48\x03\0\0\0\0\
-\0\0\x04\0\0\0\x03\0\0\0\x60\x03\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x70\x03\0\0\0\
-\0\0\0\x04\0\0\0\x04\0\0\0\x80\x03\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x90\x03\0\0\
-\0\0\0\0\x04\0\0\0\x04\0\0\0\xa0\x03\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xb0\x03\0\
-\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xc0\x03\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xd0\x03\
-\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xe0\x03\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xf0\
-\x03\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\0\x04\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x10\
-\x04\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x20\x04\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\
-\x30\x04\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x40\x04\0\0\0\0\0\0\x04\0\0\0\x04\0\0\
-\0\x50\x04\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x60\x04\0\0\0\0\0\0\x04\0\0\0\x04\0\
-\0\0\x70\x04\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x80\x04\0\0\0\0\0\0\x04\0\0\0\x04\
-\0\0\0\x90\x04\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xa0\x04\0\0\0\0\0\0\x04\0\0\0\
-\x04\0\0\0\xb0\x04\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xc0\x04\0\0\0\0\0\0\x04\0\0\
-\0\x04\0\0\0\xd0\x04\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xe0\x04\0\0\0\0\0\0\x04\0\
-\0\0\x04\0\0\0\xf0\x04\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\0\x05\0\0\0\0\0\0\x04\0\
-\0\0\x04\0\0\0\x10\x05\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x20\x05\0\0\0\0\0\0\x04\
-\0\0\0\x04\0\0\0\x30\x05\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x40\x05\0\0\0\0\0\0\
-\x04\0\0\0\x04\0\0\0\x50\x05\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x60\x05\0\0\0\0\0\
-\0\x04\0\0\0\x04\0\0\0\x70\x05\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x80\x05\0\0\0\0\
-\0\0\x04\0\0\0\x04\0\0\0\x90\x05\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xa0\x05\0\0\0\
-\0\0\0\x04\0\0\0\x04\0\0\0\xb0\x05\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xc0\x05\0\0\
-\0\0\0\0\x04\0\0\0\x04\0\0\0\xd0\x05\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xe0\x05\0\
-\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xf0\x05\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\0\x06\0\
-\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x10\x06\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x20\x06\
-\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x30\x06\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x40\
-\x06\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x50\x06\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\
-\x60\x06\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x70\x06\0\0\0\0\0\0\x04\0\0\0\x04\0\0\
-\0\x80\x06\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x90\x06\0\0\0\0\0\0\x04\0\0\0\x04\0\
-\0\0\xa0\x06\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xb0\x06\0\0\0\0\0\0\x04\0\0\0\x04\
-\0\0\0\xc0\x06\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xd0\x06\0\0\0\0\0\0\x04\0\0\0\
-\x04\0\0\0\xe0\x06\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xf0\x06\0\0\0\0\0\0\x04\0\0\
-\0\x04\0\0\0\0\x07\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x10\x07\0\0\0\0\0\0\x04\0\0\
-\0\x04\0\0\0\x20\x07\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x30\x07\0\0\0\0\0\0\x04\0\
-\0\0\x04\0\0\0\x40\x07\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x50\x07\0\0\0\0\0\0\x04\
-\0\0\0\x04\0\0\0\x60\x07\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x70\x07\0\0\0\0\0\0\
-\x04\0\0\0\x04\0\0\0\x80\x07\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x90\x07\0\0\0\0\0\
-\0\x04\0\0\0\x04\0\0\0\xa0\x07\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xb0\x07\0\0\0\0\
-\0\0\x04\0\0\0\x04\0\0\0\xc0\x07\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xd0\x07\0\0\0\
-\0\0\0\x04\0\0\0\x04\0\0\0\xe8\x07\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\xf8\x07\0\0\
-\0\0\0\0\x04\0\0\0\x05\0\0\0\x08\x08\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x18\x08\0\
-\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x28\x08\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x38\x08\
-\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x48\x08\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x58\
-\x08\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x68\x08\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\
-\x78\x08\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x88\x08\0\0\0\0\0\0\x04\0\0\0\x05\0\0\
-\0\x98\x08\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\xa8\x08\0\0\0\0\0\0\x04\0\0\0\x05\0\
-\0\0\xb8\x08\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\xc8\x08\0\0\0\0\0\0\x04\0\0\0\x05\
-\0\0\0\xd8\x08\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\xe8\x08\0\0\0\0\0\0\x04\0\0\0\
-\x05\0\0\0\xf8\x08\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x08\x09\0\0\0\0\0\0\x04\0\0\
-\0\x05\0\0\0\x18\x09\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x28\x09\0\0\0\0\0\0\x04\0\
-\0\0\x05\0\0\0\x38\x09\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x48\x09\0\0\0\0\0\0\x04\
-\0\0\0\x05\0\0\0\x58\x09\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x68\x09\0\0\0\0\0\0\
-\x04\0\0\0\x05\0\0\0\x78\x09\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x88\x09\0\0\0\0\0\
-\0\x04\0\0\0\x05\0\0\0\x98\x09\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\xa8\x09\0\0\0\0\
-\0\0\x04\0\0\0\x05\0\0\0\xb8\x09\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\xc8\x09\0\0\0\
-\0\0\0\x04\0\0\0\x05\0\0\0\xd8\x09\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\xe8\x09\0\0\
-\0\0\0\0\x04\0\0\0\x05\0\0\0\xf8\x09\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x08\x0a\0\
-\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x18\x0a\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x28\x0a\
-\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x38\x0a\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x48\
-\x0a\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x58\x0a\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\
-\x68\x0a\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x78\x0a\0\0\0\0\0\0\x04\0\0\0\x05\0\0\
-\0\x88\x0a\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x98\x0a\0\0\0\0\0\0\x04\0\0\0\x05\0\
-\0\0\xa8\x0a\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\xb8\x0a\0\0\0\0\0\0\x04\0\0\0\x05\
-\0\0\0\xc8\x0a\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\xd8\x0a\0\0\0\0\0\0\x04\0\0\0\
-\x05\0\0\0\xe8\x0a\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x04\x0b\0\0\0\0\0\0\x04\0\0\
-\0\x03\0\0\0\x14\x0b\0\0\0\0\0\0\x04\0\0\0\x03\0\0\0\x24\x0b\0\0\0\0\0\0\x04\0\
-\0\0\x03\0\0\0\x3c\x0b\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x4c\x0b\0\0\0\0\0\0\x04\
-\0\0\0\x04\0\0\0\x5c\x0b\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x6c\x0b\0\0\0\0\0\0\
-\x04\0\0\0\x04\0\0\0\x7c\x0b\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x8c\x0b\0\0\0\0\0\
-\0\x04\0\0\0\x04\0\0\0\x9c\x0b\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xac\x0b\0\0\0\0\
-\0\0\x04\0\0\0\x04\0\0\0\xbc\x0b\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xcc\x0b\0\0\0\
-\0\0\0\x04\0\0\0\x04\0\0\0\xdc\x0b\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\xec\x0b\0\0\
-\0\0\0\0\x04\0\0\0\x04\0\0\0\xfc\x0b\0\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x0c\x0c\0\
-\0\0\0\0\0\x04\0\0\0\x04\0\0\0\x24\x0c\0\0\0\0\0\0\x04\0\0\0\x05\0\0\0\x10\x12\
-\x13\x15\x16\x17\x18\x19\x1b\x11\x14\x1a\x1c\0\x2e\x74\x65\x78\x74\0\x2e\x72\
-\x65\x6c\x2e\x42\x54\x46\x2e\x65\x78\x74\0\x6b\x70\x5f\x72\x66\x75\x73\x65\x5f\
-\x73\x75\x62\x6d\x69\x74\x5f\x72\x65\x71\x75\x65\x73\x74\0\x2e\x72\x65\x6c\x6b\
-\x70\x72\x6f\x62\x65\x2f\x72\x66\x75\x73\x65\x5f\x73\x75\x62\x6d\x69\x74\x5f\
-\x72\x65\x71\x75\x65\x73\x74\0\x75\x70\x5f\x72\x66\x75\x73\x65\x5f\x72\x65\x61\
-\x64\x5f\x72\x65\x71\x75\x65\x73\x74\0\x75\x70\x5f\x72\x66\x75\x73\x65\x5f\x73\
-\x65\x6e\x64\x5f\x72\x65\x73\x75\x6c\x74\0\x72\x66\x75\x73\x65\x5f\x6c\x6f\x6f\
-\x70\x5f\x65\x76\x65\x6e\x74\x73\0\x72\x66\x75\x73\x65\x5f\x65\x76\x65\x6e\x74\
-\x73\0\x2e\x6d\x61\x70\x73\0\x72\x66\x75\x73\x65\x5f\x73\x74\x61\x74\x65\x73\0\
-\x6b\x70\x5f\x74\x72\x79\x5f\x72\x66\x75\x73\x65\x5f\x67\x65\x74\x5f\x72\x65\
-\x71\0\x2e\x72\x65\x6c\x6b\x70\x72\x6f\x62\x65\x2f\x74\x72\x79\x5f\x72\x66\x75\
-\x73\x65\x5f\x67\x65\x74\x5f\x72\x65\x71\0\x6b\x70\x5f\x72\x66\x75\x73\x65\x5f\
-\x67\x65\x74\x5f\x72\x65\x71\0\x2e\x72\x65\x6c\x6b\x70\x72\x6f\x62\x65\x2f\x72\
-\x66\x75\x73\x65\x5f\x67\x65\x74\x5f\x72\x65\x71\0\x70\x69\x64\x5f\x61\x6c\x6c\
-\x6f\x63\x5f\x6d\x61\x70\0\x2e\x6c\x6c\x76\x6d\x5f\x61\x64\x64\x72\x73\x69\x67\
-\0\x6c\x69\x63\x65\x6e\x73\x65\0\x2e\x72\x65\x6c\x75\x70\x72\x6f\x62\x65\0\x6b\
-\x70\x5f\x72\x66\x75\x73\x65\x5f\x72\x65\x71\x75\x65\x73\x74\x5f\x65\x6e\x64\0\
-\x2e\x72\x65\x6c\x6b\x70\x72\x6f\x62\x65\x2f\x72\x66\x75\x73\x65\x5f\x72\x65\
-\x71\x75\x65\x73\x74\x5f\x65\x6e\x64\0\x75\x70\x5f\x72\x66\x75\x73\x65\x5f\x63\
-\x6f\x70\x79\x5f\x74\x6f\x5f\x70\x61\x79\x6c\x6f\x61\x64\x5f\x62\x65\x67\x69\
-\x6e\x5f\x65\x6e\x64\0\x75\x70\x5f\x72\x66\x75\x73\x65\x5f\x63\x6f\x70\x79\x5f\
-\x66\x72\x6f\x6d\x5f\x70\x61\x79\x6c\x6f\x61\x64\x5f\x62\x65\x67\x69\x6e\x5f\
-\x65\x6e\x64\0\x2e\x73\x74\x72\x74\x61\x62\0\x2e\x73\x79\x6d\x74\x61\x62\0\x2e\
-\x72\x65\x6c\x2e\x42\x54\x46\0\x4c\x49\x43\x45\x4e\x53\x45\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xae\x01\0\0\x03\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\x9d\x3d\0\0\0\0\0\0\xcf\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\x01\0\0\0\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\x40\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\xf0\0\0\0\x01\0\0\0\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x40\0\0\0\0\0\
-\0\0\x70\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xec\0\
-\0\0\x09\0\0\0\x40\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x30\0\0\0\0\0\0\x10\0\0\0\0\
-\0\0\0\x14\0\0\0\x03\0\0\0\x08\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\xc2\0\0\0\x01\0\
-\0\0\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb0\0\0\0\0\0\0\0\x70\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xbe\0\0\0\x09\0\0\0\x40\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\x10\x30\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\x14\0\0\0\x05\0\0\
-\0\x08\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\x30\0\0\0\x01\0\0\0\x06\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\x20\x01\0\0\0\0\0\0\x20\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x08\0\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\x2c\0\0\0\x09\0\0\0\x40\0\0\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\x20\x30\0\0\0\0\0\0\x50\0\0\0\0\0\0\0\x14\0\0\0\x07\0\0\0\x08\0\0\0\0\0\0\0\
-\x10\0\0\0\0\0\0\0\x2d\x01\0\0\x01\0\0\0\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x40\
-\x03\0\0\0\0\0\0\xc0\x05\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x08\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\x29\x01\0\0\x09\0\0\0\x40\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x70\x30\0\0\0\
-\0\0\0\xc0\0\0\0\0\0\0\0\x14\0\0\0\x09\0\0\0\x08\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\
-\0\x4d\x01\0\0\x01\0\0\0\x06\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x09\0\0\0\0\0\0\
-\x70\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x49\x01\
-\0\0\x09\0\0\0\x40\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x30\x31\0\0\0\0\0\0\x30\0\0\0\
-\0\0\0\0\x14\0\0\0\x0b\0\0\0\x08\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\0\x21\x01\0\0\
-\x01\0\0\0\x03\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x70\x0c\0\0\0\0\0\0\x04\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x96\0\0\0\x01\0\0\0\x03\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x78\x0c\0\0\0\0\0\0\x60\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\x08\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xc2\x01\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\0\0\0\0\xd8\x0c\0\0\0\0\0\0\x2a\x15\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x04\0\
-\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xbe\x01\0\0\x09\0\0\0\x40\0\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\x60\x31\0\0\0\0\0\0\x50\0\0\0\0\0\0\0\x14\0\0\0\x0f\0\0\0\x08\0\0\0\0\0\
-\0\0\x10\0\0\0\0\0\0\0\x0b\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x04\
-\x22\0\0\0\0\0\0\x34\x0c\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x04\0\0\0\0\0\0\0\0\0\0\0\
-\0\0\0\0\x07\0\0\0\x09\0\0\0\x40\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb0\x31\0\0\0\0\
-\0\0\xe0\x0b\0\0\0\0\0\0\x14\0\0\0\x11\0\0\0\x08\0\0\0\0\0\0\0\x10\0\0\0\0\0\0\
-\0\x13\x01\0\0\x03\x4c\xff\x6f\0\0\0\x80\0\0\0\0\0\0\0\0\0\0\0\0\x90\x3d\0\0\0\
-\0\0\0\x0d\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\xb6\
-\x01\0\0\x02\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\x38\x2e\0\0\0\0\0\0\xc8\x01\
-\0\0\0\0\0\0\x01\0\0\0\x06\0\0\0\x08\0\0\0\0\0\0\0\x18\0\0\0\0\0\0\0";
-
-	return 0;
-err:
-	bpf_object__destroy_skeleton(s);
-	return -ENOMEM;
-}
-
-#endif /* __RFUSE_TRACE_BPF_SKEL_H__ */
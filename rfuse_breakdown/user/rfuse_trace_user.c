@@ -13,10 +13,17 @@
 
 #include "rfuse_common.h"
 #include "rfuse_trace.skel.h"
+#include "rfuse_loop_trace.skel.h"
 
 static volatile sig_atomic_t exiting = 0;
 static FILE *outf;
+static FILE *pollf;
+static FILE *batchf;
+static FILE *loopf;
 static uint64_t event_count;
+static uint64_t poll_hits, poll_sleeps;
+static uint64_t batches, batched;
+static uint64_t loops, loop_lock_wait_ns, loop_hold_ns;
 
 static void handle_sigint(int sig)
 {
@@ -78,6 +85,76 @@ static int handle_event(void *ctx, void *data, size_t len)
     return 0;
 }
 
+/* StackFS --sched_poll_us 이벤트 (stackfs_poll_probe) */
+static int handle_poll_event(void *ctx, void *data, size_t len)
+{
+    const struct stackfs_poll_event *e = data;
+
+    if (e->hit)
+        poll_hits++;
+    else
+        poll_sleeps++;
+    if (!pollf)
+        return 0;
+
+    fprintf(pollf, "%llu,%d,%u,%llu,%llu,%u\n",
+            (unsigned long long)e->ts_ns / 1000,
+            e->chan,
+            e->tid,
+            (unsigned long long)e->spin_ns,
+            (unsigned long long)e->poll_ns,
+            e->hit);
+    if ((poll_hits + poll_sleeps) % 100 == 0)
+        fflush(pollf);
+    return 0;
+}
+
+/* StackFS --sched_batch 이벤트 (stackfs_batch_probe) */
+static int handle_batch_event(void *ctx, void *data, size_t len)
+{
+    const struct stackfs_batch_event *e = data;
+
+    batches++;
+    batched += e->batch;
+    if (!batchf)
+        return 0;
+
+    fprintf(batchf, "%llu,%d,%u,%u,%u\n",
+            (unsigned long long)e->ts_ns / 1000,
+            e->chan,
+            e->tid,
+            e->batch,
+            e->pending);
+    if (batches % 100 == 0)
+        fflush(batchf);
+    return 0;
+}
+
+/* StackFS --sched 디스패처 루프 (stackfs_loop_probe).
+ * rfuse_latency_probe와 같은 인자: lock_wait는 CAS 재시도 시간 */
+static int handle_loop_event(void *ctx, void *data, size_t len)
+{
+    const struct rfuse_loop_event *e = data;
+
+    loops++;
+    loop_lock_wait_ns += e->lock_wait_ns;
+    loop_hold_ns += e->hold_ns;
+    if (!loopf)
+        return 0;
+
+    fprintf(loopf, "%llu,%d,%u,%llu,%llu,%llu,%llu\n",
+            (unsigned long long)e->ts_ns / 1000,
+            e->riq_id,
+            e->tid,
+            (unsigned long long)e->gap_ns,
+            (unsigned long long)e->lock_wait_ns,
+            (unsigned long long)e->hold_ns,
+            (unsigned long long)e->ioctl_postunlock_ns);
+    if (loops % 100 == 0)
+        fflush(loopf);
+    return 0;
+}
+
 /*
  * func_name 우선으로 uprobe/uretprobe attach 시도,
  * 실패하면 addr_override(offset)로 재시도.
@@ -149,6 +226,17 @@ int main(int argc, char **argv)
     struct bpf_link *link_send = NULL;
     struct bpf_link *link_copy_from = NULL;
     struct bpf_link *link_copy_to = NULL;
+    struct rfuse_loop_trace_bpf *loop_skel = NULL;
+    struct ring_buffer *poll_rb = NULL;
+    struct bpf_link *link_poll = NULL;
+    struct ring_buffer *batch_rb = NULL;
+    struct bpf_link *link_batch = NULL;
+    struct ring_buffer *loop_rb = NULL;
+    struct bpf_link *link_loop = NULL;
+    const char *stackfs_path = NULL;
+    const char *poll_path = "stackfs_poll.csv";
+    const char *batch_path = "stackfs_batch.csv";
+    const char *loop_path = "stackfs_loop.csv";
     int err = 0;
 
     /* addr overrides (optional) */
@@ -161,7 +249,9 @@ int main(int argc, char **argv)
         fprintf(stderr,
                 "Usage: %s /path/to/rfuse_daemon.so /path/to/output.csv "
                 "[--addr-read=0x.. --addr-send=0x.. "
-                "--addr-copy-from=0x.. --addr-copy-to=0x..]\n",
+                "--addr-copy-from=0x.. --addr-copy-to=0x.. "
+                "--stackfs=/path/to/StackFS --poll-out=poll.csv "
+                "--batch-out=batch.csv --loop-out=loop.csv]\n",
                 argv[0]);
         return 1;
     }
@@ -210,6 +300,14 @@ int main(int argc, char **argv)
                 fprintf(stderr, "invalid --addr-copy-to: %s\n", p);
                 return 1;
             }
+        } else if (strncmp(arg, "--stackfs=", 10) == 0) {
+            stackfs_path = arg + 10;
+        } else if (strncmp(arg, "--poll-out=", 11) == 0) {
+            poll_path = arg + 11;
+        } else if (strncmp(arg, "--batch-out=", 12) == 0) {
+            batch_path = arg + 12;
+        } else if (strncmp(arg, "--loop-out=", 11) == 0) {
+            loop_path = arg + 11;
         } else {
             fprintf(stderr, "unknown option: %s\n", arg);
             return 1;
@@ -325,6 +423,98 @@ int main(int argc, char **argv)
         goto cleanup;
     }
 
+    /* 6) StackFS stackfs_poll_probe (옵션: --stackfs 있을 때만) */
+    if (stackfs_path) {
+        loop_skel = rfuse_loop_trace_bpf__open_and_load();
+        if (!loop_skel) {
+            fprintf(stderr, "failed to open/load loop BPF skeleton\n");
+            err = -1;
+            goto cleanup;
+        }
+        link_poll = attach_uprobe_with_fallback(
+            loop_skel->progs.up_stackfs_poll_probe,
+            stackfs_path,
+            "stackfs_poll_probe",
+            false,
+            0);
+        if (!link_poll) {
+            fprintf(stderr, "failed to attach uprobe stackfs_poll_probe\n");
+            err = -1;
+            goto cleanup;
+        }
+        pollf = fopen(poll_path, "w");
+        if (!pollf) {
+            perror("fopen poll csv");
+            err = -1;
+            goto cleanup;
+        }
+        fprintf(pollf, "ts_us,chan,tid,spin_ns,poll_ns,hit\n");
+        poll_rb = ring_buffer__new(
+            bpf_map__fd(loop_skel->maps.stackfs_poll_events),
+            handle_poll_event, NULL, NULL);
+        if (!poll_rb) {
+            fprintf(stderr, "failed to create poll ring buffer\n");
+            err = -1;
+            goto cleanup;
+        }
+
+        link_batch = attach_uprobe_with_fallback(
+            loop_skel->progs.up_stackfs_batch_probe,
+            stackfs_path,
+            "stackfs_batch_probe",
+            false,
+            0);
+        if (!link_batch) {
+            fprintf(stderr, "failed to attach uprobe stackfs_batch_probe\n");
+            err = -1;
+            goto cleanup;
+        }
+        batchf = fopen(batch_path, "w");
+        if (!batchf) {
+            perror("fopen batch csv");
+            err = -1;
+            goto cleanup;
+        }
+        fprintf(batchf, "ts_us,chan,tid,batch,pending\n");
+        batch_rb = ring_buffer__new(
+            bpf_map__fd(loop_skel->maps.stackfs_batch_events),
+            handle_batch_event, NULL, NULL);
+        if (!batch_rb) {
+            fprintf(stderr, "failed to create batch ring buffer\n");
+            err = -1;
+            goto cleanup;
+        }
+
+        /* 같은 up_rfuse_latency_probe를 StackFS 루프에 붙임 */
+        link_loop = attach_uprobe_with_fallback(
+            loop_skel->progs.up_rfuse_latency_probe,
+            stackfs_path,
+            "stackfs_loop_probe",
+            false,
+            0);
+        if (!link_loop) {
+            fprintf(stderr, "failed to attach uprobe stackfs_loop_probe\n");
+            err = -1;
+            goto cleanup;
+        }
+        loopf = fopen(loop_path, "w");
+        if (!loopf) {
+            perror("fopen loop csv");
+            err = -1;
+            goto cleanup;
+        }
+        fprintf(loopf, "ts_us,chan,tid,gap_ns,lock_wait_ns,hold_ns,"
+                "postunlock_ns\n");
+        loop_rb = ring_buffer__new(
+            bpf_map__fd(loop_skel->maps.rfuse_loop_events),
+            handle_loop_event, NULL, NULL);
+        if (!loop_rb) {
+            fprintf(stderr, "failed to create loop ring buffer\n");
+            err = -1;
+            goto cleanup;
+        }
+    }
+
     /* ========== RING BUFFER ========== */
 
     rb = ring_buffer__new(bpf_map__fd(skel->maps.rfuse_events),
@@ -346,6 +536,41 @@ int main(int argc, char **argv)
             fprintf(stderr, "ring_buffer__poll failed: %d\n", err);
             break;
         }
+        if (poll_rb) {
+            err = ring_buffer__consume(poll_rb);
+            if (err < 0 && err != -EINTR) {
+                fprintf(stderr, "ring_buffer__consume failed: %d\n", err);
+                break;
+            }
+        }
+        if (batch_rb) {
+            err = ring_buffer__consume(batch_rb);
+            if (err < 0 && err != -EINTR) {
+                fprintf(stderr, "ring_buffer__consume failed: %d\n", err);
+                break;
+            }
+        }
+        if (loop_rb) {
+            err = ring_buffer__consume(loop_rb);
+            if (err < 0 && err != -EINTR) {
+                fprintf(stderr, "ring_buffer__consume failed: %d\n", err);
+                break;
+            }
+        }
+    }
+
+    if (stackfs_path) {
+        printf("stackfs poll: hits %llu, sleeps %llu\n",
+               (unsigned long long)poll_hits,
+               (unsigned long long)poll_sleeps);
+        printf("stackfs batch: %llu batches, %.2f requests each\n",
+               (unsigned long long)batches,
+               batches ? (double)batched / batches : 0.0);
+        printf("stackfs loop: %llu claims, lock wait %.1f ns, hold %.1f ns "
+               "each\n",
+               (unsigned long long)loops,
+               loops ? (double)loop_lock_wait_ns / loops : 0.0,
+               loops ? (double)loop_hold_ns / loops : 0.0);
     }
 
 cleanup:
@@ -366,10 +591,26 @@ cleanup:
         bpf_link__destroy(k_link_queue);
     if (k_link_end)
         bpf_link__destroy(k_link_end);
+    if (link_poll)
+        bpf_link__destroy(link_poll);
+    if (link_batch)
+        bpf_link__destroy(link_batch);
+    if (link_loop)
+        bpf_link__destroy(link_loop);
     if (outf)
         fclose(outf);
+    if (pollf)
+        fclose(pollf);
+    if (batchf)
+        fclose(batchf);
+    if (loopf)
+        fclose(loopf);
 
     ring_buffer__free(rb);
+    ring_buffer__free(poll_rb);
+    ring_buffer__free(batch_rb);
+    ring_buffer__free(loop_rb);
+    rfuse_loop_trace_bpf__destroy(loop_skel);
     rfuse_trace_bpf__destroy(skel);
     return err != 0;
 }